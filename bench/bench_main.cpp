@@ -0,0 +1,313 @@
+/**
+ * @file bench_main.cpp
+ * @brief Microbenchmarks for the solver's hot paths
+ *
+ * Builds as the `bench` target into bin/aof_bench. Without the build
+ * system it can be compiled directly:
+ *
+ *   g++ -std=c++17 -O2 -I include $(find src -name '*.cpp') \
+ *       bench/bench_main.cpp -o aof_bench -pthread
+ *
+ * Every benchmark reports ns/op and allocations/op (counted through the
+ * global operator new), so performance changes come with numbers instead
+ * of multi-day training anecdotes. The end-to-end benchmark reports
+ * training iterations/second for a fixed iteration count.
+ */
+
+#include "aof/card.hpp"
+#include "aof/game.hpp"
+#include "aof/game_state.hpp"
+#include "aof/poker_evaluator.hpp"
+#include "mccfr/info_set_key.hpp"
+#include "mccfr/node.hpp"
+#include "mccfr/trainer.hpp"
+#include "mccfr/strategy_kernels.hpp"
+#include "mccfr/strategy_manager.hpp"
+#include "mccfr/strategy_query.hpp"
+#include "mccfr/utils.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+
+namespace {
+
+/// Heap allocations observed since process start (incremented by the
+/// global operator new overloads below)
+std::atomic<std::uint64_t> g_allocationCount{0};
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace {
+
+/// Prevent the optimizer from discarding a benchmarked result
+template <typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+/**
+ * @brief Time a callable and report ns/op and allocations/op
+ * @param name Benchmark label
+ * @param iterations Number of calls to time
+ * @param fn Callable performing one operation
+ */
+void runBenchmark(const std::string& name, std::uint64_t iterations,
+                  const std::function<void()>& fn) {
+    // Warm up caches and lazy initialization outside the timed region
+    for (int i = 0; i < 100; ++i) {
+        fn();
+    }
+
+    std::uint64_t allocsBefore = g_allocationCount.load(std::memory_order_relaxed);
+    auto start = std::chrono::steady_clock::now();
+
+    for (std::uint64_t i = 0; i < iterations; ++i) {
+        fn();
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    std::uint64_t allocsAfter = g_allocationCount.load(std::memory_order_relaxed);
+
+    double totalNs = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    double allocsPerOp =
+        static_cast<double>(allocsAfter - allocsBefore) / iterations;
+
+    std::cout << std::left << std::setw(34) << name
+              << std::right << std::setw(12) << std::fixed << std::setprecision(1)
+              << (totalNs / iterations) << " ns/op"
+              << std::setw(10) << std::setprecision(2) << allocsPerOp
+              << " allocs/op\n";
+}
+
+void benchEvaluateHand() {
+    aof::PokerEvaluator evaluator;
+    aof::Deck deck(12345u);
+    auto cards = deck.dealCards(7);
+
+    std::vector<aof::Card> holeCards{cards[0], cards[1]};
+    std::vector<aof::Card> communityCards{cards[2], cards[3], cards[4],
+                                          cards[5], cards[6]};
+
+    runBenchmark("PokerEvaluator::evaluateHand", 1000000, [&]() {
+        auto result = evaluator.evaluateHand(holeCards, communityCards);
+        doNotOptimize(result);
+    });
+
+    std::array<aof::Card, 5> board{cards[2], cards[3], cards[4], cards[5], cards[6]};
+    runBenchmark("PokerEvaluator::evaluateHandFast", 1000000, [&]() {
+        auto value = evaluator.evaluateHandFast(cards[0], cards[1], board.data());
+        doNotOptimize(value);
+    });
+}
+
+void benchInformationSet() {
+    aof::Game game(0.4, 1.0);
+    auto state = game.createInitialState();
+    state->applyAction(aof::Action::DEAL);
+
+    runBenchmark("utils::getInformationSet", 1000000, [&]() {
+        auto infoSet = mccfr::utils::getInformationSet(*state, 2);
+        doNotOptimize(infoSet);
+    });
+
+    runBenchmark("utils::encodeInfoSet", 1000000, [&]() {
+        auto key = mccfr::utils::encodeInfoSet(*state, 2);
+        doNotOptimize(key);
+    });
+}
+
+void benchGameState() {
+    aof::Game game(0.4, 1.0);
+    auto state = game.createInitialState();
+    state->applyAction(aof::Action::DEAL);
+
+    runBenchmark("GameState copy", 1000000, [&]() {
+        aof::GameState copy(*state);
+        doNotOptimize(copy);
+    });
+
+    runBenchmark("GameState applyAction+undo", 1000000, [&]() {
+        aof::GameState::UndoToken undo;
+        state->applyAction(aof::Action::FOLD, undo);
+        state->undoAction(undo);
+    });
+}
+
+void benchTerminalReturns() {
+    aof::Game game(0.4, 1.0);
+
+    // Single main pot: everyone all-in for equal stacks (the fast path)
+    auto allIn = game.createInitialState(777u);
+    allIn->applyAction(aof::Action::DEAL);
+    for (int i = 0; i < 4; ++i) {
+        allIn->applyAction(aof::Action::ALL_IN);
+    }
+
+    runBenchmark("GameState::getReturns (all-in x4)", 200000, [&]() {
+        auto returns = allIn->getReturns();
+        doNotOptimize(returns);
+    });
+
+    // Folded blinds leave dead money below the all-in level
+    auto mixed = game.createInitialState(778u);
+    mixed->applyAction(aof::Action::DEAL);
+    mixed->applyAction(aof::Action::ALL_IN);   // CO
+    mixed->applyAction(aof::Action::FOLD);     // BTN
+    mixed->applyAction(aof::Action::FOLD);     // SB
+    mixed->applyAction(aof::Action::ALL_IN);   // BB
+
+    runBenchmark("GameState::getReturns (folds+all-in)", 200000, [&]() {
+        auto returns = mixed->getReturns();
+        doNotOptimize(returns);
+    });
+}
+
+void benchNode() {
+    mccfr::Node node(2);
+    node.updateRegret(0, 1.0);
+    node.updateRegret(1, 2.0);
+
+    runBenchmark("Node::getStrategy", 1000000, [&]() {
+        std::array<double, mccfr::Node::MAX_ACTIONS> strategy;
+        node.getStrategy(1.0, strategy.data());
+        doNotOptimize(strategy);
+    });
+}
+
+void benchStrategyKernels() {
+    // 100k two-action nodes per call: the shape of a full-map export
+    constexpr std::size_t kNodes = 100000;
+    std::vector<double> rows(kNodes * 2);
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        rows[i] = static_cast<double>(i % 7) - 2.0;
+    }
+
+    runBenchmark("kernels::averageStrategyRows (100k nodes)", 100, [&]() {
+        mccfr::kernels::averageStrategyRows(rows.data(), kNodes, 2);
+        doNotOptimize(rows.data());
+    });
+}
+
+void benchStrategyQuery() {
+    // One node per (seat, preflop bucket) pair at the opening pot: the
+    // shape of the table a live bot would load
+    mccfr::FlatNodeMap nodeMap;
+    for (int player = 0; player < 4; ++player) {
+        for (std::uint8_t r1 = 0; r1 < 13; ++r1) {
+            for (std::uint8_t r2 = 0; r2 <= r1; ++r2) {
+                for (int suited = 0; suited < 2; ++suited) {
+                    if (suited == 1 && r1 == r2) continue;
+                    aof::Card card1 = aof::Card::fromCode(r1 * 4);
+                    aof::Card card2 =
+                        aof::Card::fromCode(r2 * 4 + (suited ? 0 : 1));
+                    if (card1 == card2) continue;
+                    mccfr::InfoSetKey key = mccfr::utils::encodeInfoSet(
+                        player, 0, 0, card1, card2, 1.4);
+                    mccfr::Node& node = nodeMap.getOrCreate(key, 2);
+                    node.updateRegret(0, 1.0);
+                    node.updateRegret(1, 2.0);
+                }
+            }
+        }
+    }
+
+    mccfr::StrategyManager manager;
+    manager.loadFromNodeMap(nodeMap);
+    mccfr::StrategyQueryTable table;
+    table.build(manager);
+
+    mccfr::StrategyQuery query;
+    query.player = 2;
+    query.holeCard1 = aof::Card("A", "s");
+    query.holeCard2 = aof::Card("K", "s");
+    query.pot = 1.4;
+
+    runBenchmark("StrategyQueryTable::lookup", 1000000, [&]() {
+        std::array<double, mccfr::Node::MAX_ACTIONS> strategy;
+        int count = table.lookup(query, strategy.data());
+        doNotOptimize(count);
+        doNotOptimize(strategy);
+    });
+}
+
+void benchDeck() {
+    runBenchmark("Deck::dealCards(7)", 100000, [&]() {
+        aof::Deck deck(12345u);
+        auto cards = deck.dealCards(7);
+        doNotOptimize(cards);
+    });
+}
+
+void benchTraining() {
+    const int iterations = 20000;
+
+    aof::Game game(0.4, 1.0);
+    mccfr::Trainer trainer(game);
+
+    mccfr::TrainingConfig config;
+    config.iterations = iterations;
+    config.enableProgressOutput = false;
+    config.enableUtilityTracking = false;
+    config.outputPrefix = "bench_strategy";
+
+    auto start = std::chrono::steady_clock::now();
+    trainer.train(config);
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds =
+        std::chrono::duration_cast<std::chrono::duration<double>>(end - start).count();
+
+    std::cout << std::left << std::setw(34) << "Trainer::train (end-to-end)"
+              << std::right << std::setw(12) << std::fixed << std::setprecision(0)
+              << (iterations / seconds) << " iterations/second ("
+              << trainer.getStats().informationSetsCount << " info sets)\n";
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== All-or-Fold solver benchmarks ===\n\n";
+
+    benchEvaluateHand();
+    benchInformationSet();
+    benchGameState();
+    benchTerminalReturns();
+    benchNode();
+    benchStrategyKernels();
+    benchStrategyQuery();
+    benchDeck();
+
+    std::cout << "\n";
+    benchTraining();
+
+    return 0;
+}
@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <sstream>
 #include "mccfr/strategy_manager.hpp"
+#include "mccfr/mapped_strategy_file.hpp"
+#include "mccfr/info_set_key.hpp"
 
 void printTopStrategies(const mccfr::StrategyManager& manager, int count = 10) {
     auto topInfoSets = manager.getInfoSetsByVisitCount(true);
@@ -73,15 +75,78 @@ void analyzePlayerStrategies(const mccfr::StrategyManager& manager) {
     }
 }
 
+/**
+ * Indexed analysis of a binary strategy file: every query below is
+ * served from the embedded analytics index without deserializing the
+ * strategy map, so it stays fast on multi-million-entry files.
+ */
+int analyzeBinary(const std::string& filename) {
+    mccfr::MappedStrategyFile file;
+    if (!file.open(filename)) {
+        std::cerr << "Error: Could not map strategy file: " << filename << std::endl;
+        return 1;
+    }
+    if (!file.hasAnalyticsIndex()) {
+        std::cerr << "Error: File has no analytics index (written by an "
+                     "older build?): " << filename << std::endl;
+        return 1;
+    }
+
+    std::cout << "Mapped " << file.size() << " strategies from: " << filename << "\n";
+
+    std::cout << "\n=== Top 10 Most Visited Information Sets (indexed) ===\n";
+    int rank = 1;
+    for (const auto& entry : file.topByVisits(10)) {
+        std::cout << rank++ << ". " << mccfr::utils::decodeInfoSetString(entry.key)
+                  << "  Visits: " << entry.visitCount << "  Strategy: [";
+        for (int i = 0; i < file.numActions(); ++i) {
+            if (i > 0) std::cout << ", ";
+            std::cout << std::fixed << std::setprecision(3) << entry.strategy[i];
+        }
+        std::cout << "]\n";
+    }
+
+    std::cout << "\n=== Position Filters (indexed) ===\n";
+    for (int position = 0; position < 4; ++position) {
+        auto entries = file.filterEntries(position, -1);
+        auto bigPots = file.filterEntries(position, -1, 3.0);
+        std::cout << "Position " << position << ": " << entries.size()
+                  << " information sets, " << bigPots.size()
+                  << " with pot >= 3.0\n";
+    }
+
+    std::cout << "\n=== Most/Least Aggressive Buckets (aggregated) ===\n";
+    auto allInByBucket = file.averageActionFrequencyByBucket(1);
+    auto maxIt = std::max_element(allInByBucket.begin(), allInByBucket.end());
+    auto minIt = std::min_element(allInByBucket.begin(), allInByBucket.end());
+    std::cout << "Highest average all-in frequency: "
+              << mccfr::utils::holeBucketLabel(
+                     static_cast<int>(maxIt - allInByBucket.begin()))
+              << " (" << std::setprecision(1) << (*maxIt * 100) << "%)\n";
+    std::cout << "Lowest average all-in frequency: "
+              << mccfr::utils::holeBucketLabel(
+                     static_cast<int>(minIt - allInByBucket.begin()))
+              << " (" << (*minIt * 100) << "%)\n";
+
+    std::cout << "\nAnalysis complete!\n";
+    return 0;
+}
+
 int main(int argc, char* argv[]) {
     if (argc < 2) {
-        std::cout << "Usage: " << argv[0] << " <strategy_file.txt>\n";
+        std::cout << "Usage: " << argv[0] << " <strategy_file.txt|strategy_file.bin>\n";
         std::cout << "\nAnalyze MCCFR strategy files and provide insights.\n";
+        std::cout << "Binary files are analyzed through the embedded index.\n";
         return 1;
     }
-    
+
     std::string filename = argv[1];
-    
+
+    if (filename.size() > 4 &&
+        filename.compare(filename.size() - 4, 4, ".bin") == 0) {
+        return analyzeBinary(filename);
+    }
+
     try {
         mccfr::StrategyManager manager;
         
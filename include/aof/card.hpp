@@ -1,78 +1,186 @@
 #pragma once
 
+#include "profiling.hpp"
 #include <string>
 #include <vector>
 #include <array>
 #include <random>
-#include <unordered_map>
+#include <cstdint>
 
 namespace aof {
 
 /**
- * @brief Represents a playing card
+ * @brief Represents a playing card packed into a single byte
+ *
+ * The card is stored as a code in [0, 52): rank index (0 = "2" .. 12 = "A")
+ * times four plus suit index (0 = "c", 1 = "d", 2 = "h", 3 = "s"). This keeps
+ * copies trivial and rank/suit queries branch-free; string rank/suit remain
+ * available for I/O through static lookup tables.
  */
 class Card {
 public:
+    /// Number of distinct ranks and suits
+    static constexpr int NUM_RANKS = 13;
+    static constexpr int NUM_SUITS = 4;
+
     /**
      * @brief Construct a card with rank and suit
      * @param rank Card rank ("2"-"A")
      * @param suit Card suit ("h", "d", "c", "s")
+     * @throws std::invalid_argument if rank or suit is not recognized
      */
-    Card(std::string rank, std::string suit);
+    Card(const std::string& rank, const std::string& suit);
 
     /**
      * @brief Default constructor (invalid card)
      */
-    Card() = default;
+    constexpr Card() = default;
+
+    /**
+     * @brief Construct a card directly from its packed code
+     * @param code Packed card code in [0, 52)
+     */
+    static constexpr Card fromCode(std::uint8_t code) noexcept {
+        Card card;
+        card.code_ = code;
+        return card;
+    }
 
     // Getters
-    const std::string& getRank() const noexcept { return rank_; }
-    const std::string& getSuit() const noexcept { return suit_; }
-    
     /**
-     * @brief Get numeric value of rank (2=2, ..., A=14)
+     * @brief Get string rank ("2"-"A", empty for invalid cards)
+     */
+    const std::string& getRank() const noexcept;
+
+    /**
+     * @brief Get string suit ("c", "d", "h", "s", empty for invalid cards)
+     */
+    const std::string& getSuit() const noexcept;
+
+    /**
+     * @brief Get numeric value of rank (2=2, ..., A=14; 0 for invalid cards)
      */
-    int getRankValue() const noexcept;
-    
+    constexpr int getRankValue() const noexcept {
+        return isValid() ? 2 + (code_ >> 2) : 0;
+    }
+
+    /**
+     * @brief Get zero-based rank index (0 = "2" .. 12 = "A")
+     */
+    constexpr int getRankIndex() const noexcept { return code_ >> 2; }
+
+    /**
+     * @brief Get zero-based suit index (0 = "c", 1 = "d", 2 = "h", 3 = "s")
+     */
+    constexpr int getSuitIndex() const noexcept { return code_ & 3; }
+
+    /**
+     * @brief Get packed card code in [0, 52) (INVALID_CODE for invalid cards)
+     */
+    constexpr std::uint8_t getCode() const noexcept { return code_; }
+
+    /**
+     * @brief Get one-hot 64-bit mask with bit getCode() set (0 for invalid cards)
+     */
+    constexpr std::uint64_t getMask() const noexcept {
+        return isValid() ? (std::uint64_t{1} << code_) : 0;
+    }
+
     /**
      * @brief Get string representation of card
      */
     std::string toString() const;
-    
+
     /**
      * @brief Check if card is valid
      */
-    bool isValid() const noexcept;
+    constexpr bool isValid() const noexcept { return code_ < DECK_SIZE; }
 
     // Comparison operators
-    bool operator==(const Card& other) const noexcept;
-    bool operator!=(const Card& other) const noexcept;
-    bool operator<(const Card& other) const noexcept;
+    constexpr bool operator==(const Card& other) const noexcept {
+        return code_ == other.code_;
+    }
+    constexpr bool operator!=(const Card& other) const noexcept {
+        return code_ != other.code_;
+    }
+    constexpr bool operator<(const Card& other) const noexcept {
+        // Rank first, then suit (suit indices follow "c" < "d" < "h" < "s")
+        return code_ < other.code_;
+    }
 
 private:
-    std::string rank_;
-    std::string suit_;
-    
-    /// Rank to numeric value mapping
-    static const std::unordered_map<std::string, int> RANK_VALUES;
+    static constexpr int DECK_SIZE = NUM_RANKS * NUM_SUITS;
+    static constexpr std::uint8_t INVALID_CODE = 0xFF;
+
+    std::uint8_t code_ = INVALID_CODE;  ///< rank index * 4 + suit index
+};
+
+/**
+ * @brief Small, fast PRNG for dealing cards (xoshiro256++)
+ *
+ * Orders of magnitude cheaper to construct and step than std::mt19937,
+ * which matters because the trainer creates a deck per iteration. The
+ * seed is expanded through splitmix64, so seeds that differ in a single
+ * bit (or by +1) still yield independent streams. Not cryptographic.
+ */
+class FastRng {
+public:
+    explicit FastRng(std::uint64_t seed = std::random_device{}()) noexcept {
+        // splitmix64 expansion of the seed into the four state words
+        for (auto& word : state_) {
+            seed += 0x9E3779B97F4A7C15ULL;
+            std::uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            word = z ^ (z >> 31);
+        }
+    }
+
+    /// Next 64 random bits
+    std::uint64_t next() noexcept {
+        AOF_PROF_COUNT(RNG_DRAW);
+        std::uint64_t result = rotl(state_[0] + state_[3], 23) + state_[0];
+        std::uint64_t t = state_[1] << 17;
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = rotl(state_[3], 45);
+        return result;
+    }
+
+    /// Uniform value in [0, range) without division (Lemire reduction)
+    std::uint32_t bounded(std::uint32_t range) noexcept {
+        return static_cast<std::uint32_t>(
+            ((next() >> 32) * static_cast<std::uint64_t>(range)) >> 32);
+    }
+
+private:
+    static constexpr std::uint64_t rotl(std::uint64_t x, int k) noexcept {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    std::array<std::uint64_t, 4> state_{};
 };
 
 /**
  * @brief Manages a deck of playing cards
+ *
+ * Shuffling is lazy: cards are drawn by a partial Fisher-Yates step on
+ * first deal of each position, so a deck that only deals the 13 cards an
+ * All-or-Fold hand needs never shuffles the other 39. Constructing a
+ * deck is a 52-byte table copy plus PRNG seeding. Positions keep their
+ * drawn card until reset(), so returnCard()/dealCard() replays the same
+ * cards, which the undo-based traversal relies on.
  */
 class Deck {
 public:
-    /**
-     * @brief Create and shuffle a standard 52-card deck
-     * @param rng Random number generator for shuffling
-     */
-    explicit Deck(std::mt19937& rng);
-
     /**
      * @brief Create a deck with specific seed
-     * @param seed Seed for random number generator
+     * @param seed Seed for the dealing PRNG
      */
-    explicit Deck(std::uint32_t seed = std::random_device{}());
+    explicit Deck(std::uint64_t seed = std::random_device{}()) noexcept;
 
     /**
      * @brief Deal the next card from the deck
@@ -88,34 +196,89 @@ public:
      */
     std::vector<Card> dealCards(int count);
 
+    /**
+     * @brief Return the most recently dealt card to the deck
+     *
+     * Cards must be returned in strict reverse deal order. This restores
+     * the deck to its exact state before the matching dealCard() call, so
+     * dealing again yields the same cards. Used by GameState::undoAction.
+     * @param card Card to put back on top of the deck
+     */
+    void returnCard(Card card);
+
     /**
      * @brief Check if deck is empty
      */
-    bool isEmpty() const noexcept { return cards_.empty(); }
+    bool isEmpty() const noexcept { return dealt_ == DECK_CARDS; }
 
     /**
      * @brief Get remaining card count
      */
-    std::size_t size() const noexcept { return cards_.size(); }
+    std::size_t size() const noexcept { return DECK_CARDS - dealt_; }
 
     /**
-     * @brief Reset and reshuffle the deck
+     * @brief Reset the deck for a fresh deal
+     *
+     * All cards go back into the draw pool; the next deals draw a new
+     * random sequence from the PRNG's current state.
      */
-    void reset();
+    void reset() noexcept;
 
 private:
-    std::vector<Card> cards_;
-    std::mt19937 rng_;
-    
-    /**
-     * @brief Create a standard 52-card deck
-     */
-    static std::vector<Card> createStandardDeck();
-    
-    /**
-     * @brief Shuffle the current deck
-     */
-    void shuffle();
+    static constexpr std::uint8_t DECK_CARDS = 52;
+
+    std::array<Card, DECK_CARDS> cards_;
+    std::uint8_t dealt_ = 0;     ///< Cards handed out so far
+    std::uint8_t shuffled_ = 0;  ///< Positions already fixed by Fisher-Yates
+    FastRng rng_;
+};
+
+/**
+ * @brief Fixed-capacity inline array of cards
+ *
+ * Drop-in replacement for std::vector<Card> in hot-path state that never
+ * exceeds a known size (hole cards, community cards). Copying never
+ * allocates; the whole array is trivially copyable.
+ */
+template <std::size_t Capacity>
+class CardArray {
+public:
+    constexpr CardArray() = default;
+
+    void push_back(Card card) noexcept {
+        cards_[size_++] = card;
+    }
+
+    void clear() noexcept { size_ = 0; }
+
+    constexpr std::size_t size() const noexcept { return size_; }
+    constexpr std::size_t capacity() const noexcept { return Capacity; }
+    constexpr bool empty() const noexcept { return size_ == 0; }
+
+    constexpr const Card& operator[](std::size_t index) const noexcept {
+        return cards_[index];
+    }
+    Card& operator[](std::size_t index) noexcept { return cards_[index]; }
+
+    const Card* begin() const noexcept { return cards_.data(); }
+    const Card* end() const noexcept { return cards_.data() + size_; }
+    Card* begin() noexcept { return cards_.data(); }
+    Card* end() noexcept { return cards_.data() + size_; }
+
+    bool operator==(const CardArray& other) const noexcept {
+        if (size_ != other.size_) return false;
+        for (std::size_t i = 0; i < size_; ++i) {
+            if (cards_[i] != other.cards_[i]) return false;
+        }
+        return true;
+    }
+    bool operator!=(const CardArray& other) const noexcept {
+        return !(*this == other);
+    }
+
+private:
+    std::array<Card, Capacity> cards_{};
+    std::uint8_t size_ = 0;
 };
 
 /**
@@ -126,7 +289,95 @@ namespace card_utils {
 /**
  * @brief Check if two cards are suited (same suit)
  */
-bool areSuited(const Card& card1, const Card& card2) noexcept;
+constexpr bool areSuited(const Card& card1, const Card& card2) noexcept {
+    return card1.isValid() && card1.getSuitIndex() == card2.getSuitIndex();
+}
+
+/// Number of canonical preflop hole-card classes (13x13 grid: pairs on
+/// the diagonal, suited above it, offsuit below)
+inline constexpr int NUM_HOLE_BUCKETS = 169;
+
+/**
+ * @brief Get the canonical preflop bucket id for two hole cards
+ *
+ * A single comparison and array-free arithmetic; the id layout matches
+ * the solver's packed information set encoding.
+ *
+ * @param card1 First hole card
+ * @param card2 Second hole card
+ * @return Bucket id in [0, NUM_HOLE_BUCKETS)
+ */
+constexpr int getBucketId(const Card& card1, const Card& card2) noexcept {
+    int high = card1.getRankIndex();
+    int low = card2.getRankIndex();
+    if (high < low) {
+        int tmp = high;
+        high = low;
+        low = tmp;
+    }
+
+    if (high == low || areSuited(card1, card2)) {
+        return high * 13 + low;       // Pair (diagonal) or suited (upper)
+    }
+    return low * 13 + high;           // Offsuit (lower triangle)
+}
+
+/// NUL-terminated bucket label; sized for the two-character "10" rank
+/// appearing twice plus a suffix ("1010", "A10s", ...)
+struct BucketLabel {
+    char text[6];
+};
+
+namespace detail {
+
+inline constexpr const char* BUCKET_RANK_LABELS[Card::NUM_RANKS] = {
+    "2", "3", "4", "5", "6", "7", "8", "9", "10", "J", "Q", "K", "A"
+};
+
+/// Generate all 169 labels at compile time, indexed by bucket id
+constexpr std::array<BucketLabel, NUM_HOLE_BUCKETS> makeBucketLabels() {
+    std::array<BucketLabel, NUM_HOLE_BUCKETS> labels{};
+    for (int row = 0; row < 13; ++row) {
+        for (int col = 0; col < 13; ++col) {
+            char* out = labels[row * 13 + col].text;
+            int length = 0;
+            auto append = [&](const char* s) {
+                while (*s != '\0') {
+                    out[length++] = *s++;
+                }
+            };
+            if (row == col) {
+                append(BUCKET_RANK_LABELS[row]);               // Pair
+                append(BUCKET_RANK_LABELS[col]);
+            } else if (row > col) {
+                append(BUCKET_RANK_LABELS[row]);               // Suited
+                append(BUCKET_RANK_LABELS[col]);
+                append("s");
+            } else {
+                append(BUCKET_RANK_LABELS[col]);               // Offsuit
+                append(BUCKET_RANK_LABELS[row]);
+                append("o");
+            }
+            out[length] = '\0';
+        }
+    }
+    return labels;
+}
+
+} // namespace detail
+
+/// Compile-time table of the 169 bucket labels, indexed by bucket id
+inline constexpr std::array<BucketLabel, NUM_HOLE_BUCKETS> HOLE_BUCKET_LABELS =
+    detail::makeBucketLabels();
+
+/**
+ * @brief Get display label for a hole-card bucket ("AKs", "109o", "77", ...)
+ * @param bucketId Bucket id in [0, NUM_HOLE_BUCKETS)
+ * @return NUL-terminated label from the compile-time table
+ */
+constexpr const char* getBucketLabel(int bucketId) noexcept {
+    return HOLE_BUCKET_LABELS[bucketId].text;
+}
 
 /**
  * @brief Get abstracted representation of hole cards for information sets
@@ -142,11 +393,10 @@ std::string getAbstractedHoleCards(const Card& card1, const Card& card2);
 const std::vector<std::string>& getAllRanks();
 
 /**
- * @brief Get all possible suits  
+ * @brief Get all possible suits
  */
 const std::vector<std::string>& getAllSuits();
 
 } // namespace card_utils
 
 } // namespace aof
-
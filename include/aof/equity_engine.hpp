@@ -0,0 +1,114 @@
+#pragma once
+
+#include "card.hpp"
+#include "game_config.hpp"
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace aof {
+
+/**
+ * @brief Cached all-in equity tables for terminal showdowns
+ *
+ * AoF hands always end all-in or folded, so the value of a showdown is
+ * fully determined by the contenders' hole cards. This engine maps each
+ * matchup to the 169-bucket preflop classes of its contenders and keeps a
+ * table of per-bucket-tuple equities, so a terminal node can return
+ * expected utilities directly instead of sampling one random board
+ * through the evaluator.
+ *
+ * Entries are estimated once per distinct bucket tuple by dealing many
+ * boards (and concrete hole cards consistent with the buckets) with a
+ * deterministic per-entry seed, then cached. Tables can be saved after a
+ * run and loaded at startup, so the estimation cost is paid once offline
+ * rather than on every training run. All methods are thread-safe.
+ */
+class EquityEngine {
+public:
+    /// Boards sampled when estimating a table entry for the first time
+    static constexpr int DEFAULT_SAMPLES_PER_ENTRY = 20000;
+
+    /**
+     * @brief Construct engine with estimation parameters
+     * @param samplesPerEntry Deals sampled per new table entry
+     * @param seed Base seed mixed into each entry's deterministic RNG
+     */
+    explicit EquityEngine(int samplesPerEntry = DEFAULT_SAMPLES_PER_ENTRY,
+                          std::uint64_t seed = 0x853c49e6748fea9bULL);
+
+    /**
+     * @brief Get all-in equities for a showdown
+     *
+     * Hole cards are laid out two per contender, matching the evaluator's
+     * convention. Equities are probabilities of pot share and sum to 1.
+     *
+     * @param holeCards Hole cards, two per contender
+     * @param numContenders Number of contenders (2-4)
+     * @param equities Output array of numContenders equities
+     */
+    void getEquities(const Card* holeCards, int numContenders,
+                     double* equities) const;
+
+    /**
+     * @brief Estimate equities for a concrete lineup by bulk board sampling
+     *
+     * Unlike getEquities(), this keeps the exact hole cards (no bucket
+     * abstraction, no caching): boards are drawn in batches from the
+     * packed-card residual deck and the whole lineup is ranked per board
+     * through the batch evaluator. Deterministic for a given seed.
+     *
+     * @param holeCards Hole cards, two per contender
+     * @param numContenders Number of contenders (2-4)
+     * @param numBoards Boards to sample (positive)
+     * @param seed Seed for the board-sampling RNG, mixed with the
+     *             engine's base seed
+     * @param equities Output array of numContenders equities (sum to 1)
+     * @throws std::invalid_argument on bad counts or duplicate hole cards
+     */
+    void estimateEquities(const Card* holeCards, int numContenders,
+                          int numBoards, std::uint64_t seed,
+                          double* equities) const;
+
+    /**
+     * @brief Load a previously saved equity table
+     * @param filename Input filename
+     * @return True if the file was read successfully
+     */
+    bool loadTable(const std::string& filename);
+
+    /**
+     * @brief Save the current equity table
+     * @param filename Output filename
+     * @return True if the file was written successfully
+     */
+    bool saveTable(const std::string& filename) const;
+
+    /**
+     * @brief Number of cached bucket-tuple entries
+     */
+    std::size_t tableSize() const;
+
+private:
+    /// Sorted bucket ids packed one per byte (unused slots hold 0xFF)
+    using BucketKey = std::uint64_t;
+
+    /// Per-entry equities in sorted-bucket slot order
+    using Entry = std::array<double, GameConfig::NUM_PLAYERS>;
+
+    int samplesPerEntry_;
+    std::uint64_t seed_;
+    mutable std::unordered_map<BucketKey, Entry> table_;
+    mutable std::mutex mutex_;
+
+    /**
+     * @brief Estimate equities for a sorted bucket tuple by sampling deals
+     * @param sortedBuckets Bucket ids in ascending order
+     * @param numContenders Number of contenders (2-4)
+     */
+    Entry computeEntry(const int* sortedBuckets, int numContenders) const;
+};
+
+} // namespace aof
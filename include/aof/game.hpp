@@ -7,6 +7,8 @@
 
 namespace aof {
 
+class EquityEngine;
+
 /**
  * @brief Main All-or-Fold poker game class
  */
@@ -30,6 +32,13 @@ public:
      */
     std::unique_ptr<GameState> createInitialState() const;
 
+    /**
+     * @brief Create a new initial game state with a seeded deck
+     * @param deckSeed Seed for the state's dealing PRNG
+     * @return Fresh game state ready for play
+     */
+    std::unique_ptr<GameState> createInitialState(std::uint64_t deckSeed) const;
+
     // Getters
     double getSmallBlind() const noexcept { return smallBlind_; }
     double getBigBlind() const noexcept { return bigBlind_; }
@@ -43,6 +52,26 @@ public:
      */
     double getInitialStack(int player) const;
 
+    /**
+     * @brief Enable expected-value terminal evaluation
+     *
+     * When an equity engine is set, terminal showdowns return expected
+     * utilities from cached all-in equities instead of evaluating one
+     * sampled board. Pass nullptr to restore sampled-board evaluation.
+     *
+     * @param engine Shared equity engine (may be shared across games)
+     */
+    void setEquityEngine(std::shared_ptr<const EquityEngine> engine) {
+        equityEngine_ = std::move(engine);
+    }
+
+    /**
+     * @brief Get the equity engine, or nullptr for sampled-board terminals
+     */
+    const EquityEngine* getEquityEngine() const noexcept {
+        return equityEngine_.get();
+    }
+
     /**
      * @brief Validate game configuration
      * @throws std::invalid_argument if configuration is invalid
@@ -54,6 +83,7 @@ private:
     double bigBlind_;
     GameParameters gameParams_;
     std::vector<double> initialStacks_;  // In actual chip amounts
+    std::shared_ptr<const EquityEngine> equityEngine_;  // Optional terminal mode
 
     /**
      * @brief Initialize default starting stacks
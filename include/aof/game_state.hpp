@@ -2,9 +2,10 @@
 
 #include "types.hpp"
 #include "card.hpp"
+#include "game_config.hpp"
+#include <array>
+#include <cstdint>
 #include <vector>
-#include <set>
-#include <memory>
 #include <string>
 
 namespace aof {
@@ -12,8 +13,20 @@ namespace aof {
 // Forward declaration
 class Game;
 
+/// Inline storage for all players' hole cards (2 per player)
+using HoleCardArray = CardArray<GameConfig::NUM_PLAYERS * GameConfig::HOLE_CARDS_PER_PLAYER>;
+
+/// Inline storage for the community cards
+using CommunityCardArray = CardArray<GameConfig::COMMUNITY_CARDS>;
+
 /**
  * @brief Represents the complete state of an All-or-Fold poker game
+ *
+ * The state is trivially copyable: player status lives in two uint8_t
+ * bitmasks (bit p set = player p folded / all-in), stacks in fixed
+ * arrays, side pots in an inline array of (amount, eligibility mask)
+ * pairs and the deck inline by value. Cloning a state is a flat memcpy
+ * with no allocations, and status queries are single bit tests.
  */
 class GameState {
 public:
@@ -24,14 +37,21 @@ public:
     explicit GameState(const Game* game);
 
     /**
-     * @brief Copy constructor for state cloning
+     * @brief Construct initial game state with a seeded deck
+     * @param game Pointer to parent game instance
+     * @param deckSeed Seed for the dealing PRNG
      */
-    GameState(const GameState& other);
+    GameState(const Game* game, std::uint64_t deckSeed);
+
+    /**
+     * @brief Copy constructor for state cloning (flat copy, no allocations)
+     */
+    GameState(const GameState& other) = default;
 
     /**
      * @brief Assignment operator
      */
-    GameState& operator=(const GameState& other);
+    GameState& operator=(const GameState& other) = default;
 
     // State queries
     /**
@@ -63,29 +83,63 @@ public:
     /**
      * @brief Get player stack sizes
      */
-    const std::vector<double>& getPlayerStacks() const noexcept { return playerStacks_; }
+    const std::array<double, GameConfig::NUM_PLAYERS>& getPlayerStacks() const noexcept {
+        return playerStacks_;
+    }
 
     /**
-     * @brief Get folded status for all players
+     * @brief Get folded players as a bitmask (bit p set = player p folded)
      */
-    const std::vector<bool>& getFoldedPlayers() const noexcept { return folded_; }
+    std::uint8_t getFoldedMask() const noexcept { return foldedMask_; }
 
     /**
-     * @brief Get all-in players
+     * @brief Get all-in players as a bitmask (bit p set = player p all-in)
      */
-    const std::set<int>& getAllInPlayers() const noexcept { return allInPlayers_; }
+    std::uint8_t getAllInMask() const noexcept { return allInMask_; }
+
+    /**
+     * @brief Check whether a player has folded
+     */
+    bool hasFolded(int player) const noexcept {
+        return (foldedMask_ >> player) & 1;
+    }
+
+    /**
+     * @brief Check whether a player is all-in
+     */
+    bool isAllIn(int player) const noexcept {
+        return (allInMask_ >> player) & 1;
+    }
 
     /**
      * @brief Get hole cards for all players
      */
-    const std::vector<Card>& getHoleCards() const noexcept { return holeCards_; }
+    const HoleCardArray& getHoleCards() const noexcept { return holeCards_; }
 
     /**
      * @brief Get community cards
      */
-    const std::vector<Card>& getCommunityCards() const noexcept { return communityCards_; }
+    const CommunityCardArray& getCommunityCards() const noexcept { return communityCards_; }
 
     // State modification
+    /**
+     * @brief Records what applyAction changed so the action can be reversed
+     *
+     * Filled by applyAction(Action, UndoToken&) and consumed by
+     * undoAction(). Tokens must be undone in strict reverse order of
+     * application; the token is only valid while no other modification
+     * has touched the state in between.
+     */
+    struct UndoToken {
+        Action action = Action::FOLD;  ///< Action that was applied
+        int player = -1;               ///< Seat that acted (-1 for DEAL)
+        int prevNextPlayer = 0;        ///< Acting order position before the action
+        double prevPot = 0.0;          ///< Pot before the action
+        double prevStack = 0.0;        ///< Acting player's stack before the action
+        bool endedGame = false;        ///< Action made the state terminal
+        bool dealtCommunity = false;   ///< Community cards were dealt at game end
+    };
+
     /**
      * @brief Apply an action and advance the game state
      * @param action Action to apply
@@ -93,6 +147,27 @@ public:
      */
     void applyAction(Action action);
 
+    /**
+     * @brief Apply an action, recording how to reverse it
+     *
+     * Together with undoAction() this lets tree traversals walk the game
+     * on a single state object instead of deep-copying it per action.
+     * @param action Action to apply
+     * @param token Receives the undo record for this action
+     * @throws std::invalid_argument if action is not legal
+     */
+    void applyAction(Action action, UndoToken& token);
+
+    /**
+     * @brief Reverse the most recently applied action
+     *
+     * Restores folded/all-in status, stacks, pot, acting order and — for
+     * game-ending actions — returns any community cards dealt at game end
+     * to the deck, so a subsequent deal produces the same cards.
+     * @param token Undo record from the matching applyAction call
+     */
+    void undoAction(const UndoToken& token);
+
     /**
      * @brief Get final payoffs for all players (only valid if terminal)
      * @return Payoffs for each player
@@ -111,6 +186,12 @@ public:
     GameState clone() const { return *this; }
 
 private:
+    /// One pot layer with the mask of non-folded players eligible to win it
+    struct SidePot {
+        double amount = 0.0;
+        std::uint8_t eligibleMask = 0;
+    };
+
     // Game reference
     const Game* game_;
 
@@ -118,20 +199,21 @@ private:
     bool gameOver_;
     int nextPlayer_;
     double pot_;
-    
+
     // Player information
-    std::vector<double> initialStacks_;
-    std::vector<double> playerStacks_;
-    std::vector<bool> folded_;
-    std::set<int> allInPlayers_;
-
-    // Cards
-    std::unique_ptr<Deck> deck_;
-    std::vector<Card> holeCards_;
-    std::vector<Card> communityCards_;
-
-    // Side pots for all-in scenarios
-    std::vector<std::pair<double, std::vector<int>>> sidePots_;
+    std::array<double, GameConfig::NUM_PLAYERS> initialStacks_;
+    std::array<double, GameConfig::NUM_PLAYERS> playerStacks_;
+    std::uint8_t foldedMask_;   ///< Bit p set = player p folded
+    std::uint8_t allInMask_;    ///< Bit p set = player p all-in
+
+    // Cards (inline fixed-size storage so copying a state never allocates)
+    Deck deck_;
+    HoleCardArray holeCards_;
+    CommunityCardArray communityCards_;
+
+    // Side pots for all-in scenarios (at most one layer per player)
+    std::array<SidePot, GameConfig::NUM_PLAYERS> sidePots_;
+    std::uint8_t numSidePots_;
 
     // Private methods
     /**
@@ -12,6 +12,16 @@ namespace aof {
  */
 using HandScore = std::vector<int>;
 
+/**
+ * @brief Single comparable integer encoding of a 7-card hand's strength
+ *
+ * Layout: hand rank in bits 20-23, then up to five tiebreaker ranks
+ * (card values 2-14) packed one nibble each from bit 16 down. Higher
+ * values always beat lower values, so hands compare with plain integer
+ * comparison and no allocation.
+ */
+using HandValue = std::uint32_t;
+
 /**
  * @brief Evaluates poker hands according to standard rules
  */
@@ -35,6 +45,58 @@ public:
      */
     HandScore evaluateFiveCardHand(const std::vector<Card>& hand) const;
 
+    /**
+     * @brief Evaluate the best 7-card hand without allocating
+     *
+     * Fast path for training showdowns: builds per-suit rank bitmasks and
+     * resolves the hand class through precomputed straight tables instead
+     * of enumerating five-card combinations. Produces the same ordering
+     * as evaluateHand() but as a single comparable integer.
+     *
+     * @param hole1 First hole card
+     * @param hole2 Second hole card
+     * @param communityCards Pointer to exactly 5 community cards
+     * @return Packed hand value (higher wins)
+     */
+    HandValue evaluateHandFast(Card hole1, Card hole2,
+                              const Card* communityCards) const noexcept;
+
+    /**
+     * @brief Rank several players' hands against one board in a single pass
+     *
+     * The board masks are built once and each player's two hole cards are
+     * added incrementally, so a 4-player showdown costs little more than a
+     * single evaluation.
+     *
+     * @param holeCards Hole cards laid out two per player
+     * @param numPlayers Number of players (holeCards has 2 * numPlayers entries)
+     * @param communityCards Pointer to exactly 5 community cards
+     * @param results Output array of numPlayers hand values
+     */
+    void evaluateHandsFast(const Card* holeCards, int numPlayers,
+                          const Card* communityCards,
+                          HandValue* results) const noexcept;
+
+    /**
+     * @brief Rank one lineup of players against many boards
+     *
+     * Bulk entry point for Monte Carlo board sampling: each player's hole
+     * card masks are built once and only the five board cards are folded
+     * in per board, so the per-board cost is five mask updates plus one
+     * table-driven evaluation per player. Produces exactly the values
+     * evaluateHandsFast() would return board by board.
+     *
+     * @param holeCards Hole cards laid out two per player
+     * @param numPlayers Number of players (at most 8)
+     * @param boards Boards laid out five cards per board
+     * @param numBoards Number of boards
+     * @param results Output array of numBoards * numPlayers hand values,
+     *                numPlayers consecutive values per board
+     */
+    void evaluateBoardsFast(const Card* holeCards, int numPlayers,
+                           const Card* boards, int numBoards,
+                           HandValue* results) const noexcept;
+
     /**
      * @brief Compare two hand scores
      * @param score1 First hand score
@@ -0,0 +1,246 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @file profiling.hpp
+ * @brief Compile-time-gated hot-path instrumentation
+ *
+ * Build with -DAOF_PROFILE to enable. Instrumented sites bump a
+ * thread-local counter (one relaxed increment, no locks on the hot
+ * path) or time a scope; collect() aggregates every thread's counters
+ * for reporting. Without the flag the macros expand to nothing and
+ * collect() returns an empty report, so shipping code keeps the
+ * AOF_PROF_* annotations with zero cost.
+ *
+ * All translation units must agree on the flag: mixing instrumented
+ * and uninstrumented objects in one binary is not supported.
+ */
+
+namespace aof {
+namespace profiling {
+
+/// Hot-path event counters
+enum class Counter : int {
+    NODE_MAP_PROBE,      ///< Slot comparisons in FlatNodeMap lookups
+    NODE_MAP_MISS,       ///< FlatNodeMap lookups that created a node
+    HAND_EVAL,           ///< PokerEvaluator hand evaluations
+    STATE_ACTION,        ///< GameState::applyAction calls
+    INFOSET_ENCODE,      ///< Packed information set constructions
+    RNG_DRAW,            ///< FastRng outputs consumed
+    BRANCH_PRUNED,       ///< Trained-player subtrees skipped by regret pruning
+    COUNT                ///< Number of counters (not a counter)
+};
+
+/// Timed hot-path sections
+enum class Timer : int {
+    TRAVERSAL,           ///< MCCFR tree traversals (all players, one deal)
+    TERMINAL_EVAL,       ///< Exact terminal utility evaluation per iteration
+    COUNT                ///< Number of timers (not a timer)
+};
+
+/// One aggregated counter or timer for reporting
+struct Entry {
+    std::string name;        ///< Stable identifier (used as the JSON key)
+    std::uint64_t count = 0; ///< Event count (or number of timed scopes)
+    std::uint64_t totalNs = 0;  ///< Accumulated wall time (timers only)
+};
+
+inline const char* counterName(Counter counter) noexcept {
+    switch (counter) {
+        case Counter::NODE_MAP_PROBE: return "node_map_probes";
+        case Counter::NODE_MAP_MISS:  return "node_map_misses";
+        case Counter::HAND_EVAL:      return "hand_evaluations";
+        case Counter::STATE_ACTION:   return "state_actions";
+        case Counter::INFOSET_ENCODE: return "infoset_encodes";
+        case Counter::RNG_DRAW:       return "rng_draws";
+        case Counter::BRANCH_PRUNED:  return "branches_pruned";
+        default:                      return "unknown";
+    }
+}
+
+inline const char* timerName(Timer timer) noexcept {
+    switch (timer) {
+        case Timer::TRAVERSAL:     return "traversal";
+        case Timer::TERMINAL_EVAL: return "terminal_eval";
+        default:                   return "unknown";
+    }
+}
+
+} // namespace profiling
+} // namespace aof
+
+#ifdef AOF_PROFILE
+
+#include <chrono>
+#include <mutex>
+
+namespace aof {
+namespace profiling {
+
+/**
+ * @brief Per-thread counter block, registered globally on first use
+ *
+ * Registered blocks are never unregistered: short-lived worker threads
+ * leave their totals behind so collect() still sees their work. The
+ * registry stores the blocks themselves (not pointers into dead
+ * thread-local storage) via a stable deque-like list under a mutex.
+ */
+struct CounterBlock {
+    std::uint64_t counts[static_cast<int>(Counter::COUNT)] = {};
+    std::uint64_t timerCounts[static_cast<int>(Timer::COUNT)] = {};
+    std::uint64_t timerNs[static_cast<int>(Timer::COUNT)] = {};
+};
+
+namespace detail {
+
+inline std::mutex& registryMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+/// Blocks of threads that have exited, folded in at unregistration
+inline CounterBlock& retiredBlock() {
+    static CounterBlock block;
+    return block;
+}
+
+inline std::vector<CounterBlock*>& registry() {
+    static std::vector<CounterBlock*> blocks;
+    return blocks;
+}
+
+/// Registers on construction, folds the totals into the retired block
+/// on thread exit so no dangling pointer stays in the registry
+struct RegisteredBlock {
+    CounterBlock block;
+
+    RegisteredBlock() {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        registry().push_back(&block);
+    }
+
+    ~RegisteredBlock() {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        CounterBlock& retired = retiredBlock();
+        for (int i = 0; i < static_cast<int>(Counter::COUNT); ++i) {
+            retired.counts[i] += block.counts[i];
+        }
+        for (int i = 0; i < static_cast<int>(Timer::COUNT); ++i) {
+            retired.timerCounts[i] += block.timerCounts[i];
+            retired.timerNs[i] += block.timerNs[i];
+        }
+        auto& blocks = registry();
+        for (std::size_t i = 0; i < blocks.size(); ++i) {
+            if (blocks[i] == &block) {
+                blocks[i] = blocks.back();
+                blocks.pop_back();
+                break;
+            }
+        }
+    }
+};
+
+} // namespace detail
+
+/// This thread's counter block (created and registered on first use)
+inline CounterBlock& threadBlock() {
+    thread_local detail::RegisteredBlock registered;
+    return registered.block;
+}
+
+inline void bump(Counter counter) noexcept {
+    ++threadBlock().counts[static_cast<int>(counter)];
+}
+
+/// Times a scope into a thread-local timer slot
+class ScopedTimer {
+public:
+    explicit ScopedTimer(Timer timer) noexcept
+        : timer_(timer), start_(std::chrono::steady_clock::now()) {}
+
+    ~ScopedTimer() {
+        auto elapsed = std::chrono::steady_clock::now() - start_;
+        CounterBlock& block = threadBlock();
+        ++block.timerCounts[static_cast<int>(timer_)];
+        block.timerNs[static_cast<int>(timer_)] += static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Timer timer_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+/**
+ * @brief Aggregate all threads' counters into a report
+ *
+ * Counters come first, then timers; timer entries carry totalNs.
+ */
+inline std::vector<Entry> collect() {
+    CounterBlock total = detail::retiredBlock();
+    {
+        std::lock_guard<std::mutex> lock(detail::registryMutex());
+        for (const CounterBlock* block : detail::registry()) {
+            for (int i = 0; i < static_cast<int>(Counter::COUNT); ++i) {
+                total.counts[i] += block->counts[i];
+            }
+            for (int i = 0; i < static_cast<int>(Timer::COUNT); ++i) {
+                total.timerCounts[i] += block->timerCounts[i];
+                total.timerNs[i] += block->timerNs[i];
+            }
+        }
+    }
+
+    std::vector<Entry> entries;
+    entries.reserve(static_cast<int>(Counter::COUNT) +
+                    static_cast<int>(Timer::COUNT));
+    for (int i = 0; i < static_cast<int>(Counter::COUNT); ++i) {
+        entries.push_back({counterName(static_cast<Counter>(i)),
+                           total.counts[i], 0});
+    }
+    for (int i = 0; i < static_cast<int>(Timer::COUNT); ++i) {
+        entries.push_back({std::string(timerName(static_cast<Timer>(i))) + "_ns",
+                           total.timerCounts[i], total.timerNs[i]});
+    }
+    return entries;
+}
+
+/// Zero every registered and retired counter (for test isolation)
+inline void resetAll() {
+    std::lock_guard<std::mutex> lock(detail::registryMutex());
+    detail::retiredBlock() = CounterBlock{};
+    for (CounterBlock* block : detail::registry()) {
+        *block = CounterBlock{};
+    }
+}
+
+} // namespace profiling
+} // namespace aof
+
+#define AOF_PROF_COUNT(slot) \
+    ::aof::profiling::bump(::aof::profiling::Counter::slot)
+#define AOF_PROF_TIMER(var, slot) \
+    ::aof::profiling::ScopedTimer var(::aof::profiling::Timer::slot)
+
+#else // !AOF_PROFILE
+
+namespace aof {
+namespace profiling {
+
+/// Disabled build: no counters exist and reports are empty
+inline std::vector<Entry> collect() { return {}; }
+inline void resetAll() {}
+
+} // namespace profiling
+} // namespace aof
+
+#define AOF_PROF_COUNT(slot) ((void)0)
+#define AOF_PROF_TIMER(var, slot) ((void)0)
+
+#endif // AOF_PROFILE
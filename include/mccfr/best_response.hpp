@@ -0,0 +1,137 @@
+#pragma once
+
+#include "info_set_key.hpp"
+#include "node.hpp"
+#include "flat_node_map.hpp"
+#include "strategy_manager.hpp"
+#include "../aof/game.hpp"
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+
+namespace mccfr {
+
+/**
+ * @brief Exploitability of an average strategy profile
+ *
+ * All values are in chips per hand. For each player the best-response
+ * value is what a perfectly informed deviator earns when everyone else
+ * keeps playing the profile; the profile value is what the player earns
+ * without deviating. Their averaged difference is the exploitability:
+ * zero at equilibrium, and since the game is zero-sum it equals the
+ * averaged best-response values alone.
+ */
+struct ExploitabilityResult {
+    std::array<double, aof::GameConfig::NUM_PLAYERS> bestResponseValues{};
+    std::array<double, aof::GameConfig::NUM_PLAYERS> profileValues{};
+    double exploitability = 0.0;  ///< Mean per-player best-response gain
+    int numDeals = 0;             ///< Hole-card deals the estimate used
+};
+
+/**
+ * @brief Best-response engine measuring exploitability of a profile
+ *
+ * Computes, per player, the value of the best response to the loaded
+ * average strategies. The all-in-or-fold betting tree is tiny (each
+ * player acts at most once), so per sampled deal the tree is solved
+ * exactly: best-response action values are accumulated per information
+ * set weighted by the opponents' reach, and only after all deals are in
+ * is the maximizing action chosen — the deviator exploits what it can
+ * observe, never the sampled hidden cards. The chance expectation over
+ * deals is estimated by Monte Carlo, parallelized across deals with
+ * per-deal seeds so results are independent of the thread count.
+ *
+ * Unknown information sets play uniformly, matching what the trainer's
+ * regret matching returns before any regret accumulates.
+ */
+class BestResponseEvaluator {
+public:
+    /**
+     * @brief Construct evaluator for given game
+     * @param game Game instance the profile was trained on
+     */
+    explicit BestResponseEvaluator(const aof::Game& game);
+
+    /**
+     * @brief Load average strategies from a trained flat node map
+     * @param nodeMap Packed-key node map
+     */
+    void loadFromNodeMap(const FlatNodeMap& nodeMap);
+
+    /**
+     * @brief Load average strategies from a strategy manager
+     *
+     * Strategies whose information set string does not parse into a
+     * packed key are skipped.
+     *
+     * @param manager Manager holding saved strategies
+     */
+    void loadFromStrategyManager(const StrategyManager& manager);
+
+    /**
+     * @brief Estimate exploitability of the loaded profile
+     * @param numDeals Hole-card deals to sample
+     * @param numThreads Worker threads to spread the deals over
+     * @param seed Seed for the deal sequence (reproducible)
+     * @return Per-player best-response and profile values
+     */
+    ExploitabilityResult evaluate(int numDeals, int numThreads = 1,
+                                  std::uint64_t seed = 1) const;
+
+    /**
+     * @brief Get number of loaded strategies
+     */
+    std::size_t size() const noexcept { return strategies_.size(); }
+
+private:
+    /// Action probabilities of one information set
+    using Strategy = std::array<double, Node::MAX_ACTIONS>;
+
+    /// Per-information-set accumulator for best-response action values
+    struct ActionValues {
+        Strategy value{};  ///< Reach-weighted expected utility per action
+    };
+
+    using Accumulator = std::unordered_map<InfoSetKey, ActionValues>;
+
+    const aof::Game& game_;
+    std::unordered_map<InfoSetKey, Strategy> strategies_;
+
+    /**
+     * @brief Get the profile's strategy at a state (uniform if unknown)
+     * @param state Current state (at a decision node)
+     * @param player Acting player
+     * @param strategy Receives the action probabilities
+     */
+    void profileStrategy(const aof::GameState& state, int player,
+                         double* strategy) const;
+
+    /**
+     * @brief Expected utility for a player with everyone playing the profile
+     * @param state Traversal state (restored before returning)
+     * @param forPlayer Player whose utility is computed
+     * @return Expected utility in chips
+     */
+    double profileValue(aof::GameState& state, int forPlayer) const;
+
+    /**
+     * @brief Accumulate best-response action values over one deal
+     *
+     * Walks the betting tree with opponents playing the profile. At the
+     * deviating player's nodes every action's continuation value is
+     * added to the accumulator under the node's information set key; on
+     * paths where the player never gets to act the terminal utility goes
+     * to the fixed baseline.
+     *
+     * @param state Traversal state (restored before returning)
+     * @param forPlayer Deviating player
+     * @param oppReach Product of opponents' reach probabilities
+     * @param accumulator Per-information-set action values
+     * @param baseline Receives reach-weighted utility of no-choice paths
+     */
+    void accumulateBestResponse(aof::GameState& state, int forPlayer,
+                                double oppReach, Accumulator& accumulator,
+                                double& baseline) const;
+};
+
+} // namespace mccfr
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "flat_node_map.hpp"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace mccfr {
+
+/**
+ * @brief File-based regret exchange between independent trainer processes
+ *
+ * Each worker trains its own node map and periodically publishes the
+ * regret/strategy sums it accumulated since its previous publish as a
+ * binary delta file in a shared directory (local disk for multi-process
+ * runs, a network mount for multi-host runs). Workers poll the directory
+ * and additively merge every other worker's unconsumed deltas into their
+ * own map; regret matching is linear in the sums, so the merged map
+ * behaves as if all iterations had run locally.
+ *
+ * Exchanging deltas rather than totals makes merging idempotent per
+ * file: each (worker, epoch) pair is applied exactly once, tracked by
+ * epoch number, so repeated polling never double-counts. Files are
+ * published atomically (write to a temp name, then rename) and each
+ * worker prunes its own files after a retention window.
+ */
+class DistributedSync {
+public:
+    /// Published epochs kept on disk per worker; peers further behind
+    /// than this lose the pruned deltas
+    static constexpr int EPOCH_RETENTION = 8;
+
+    /**
+     * @brief Construct sync endpoint for one worker
+     * @param syncDirectory Shared directory (created if missing)
+     * @param workerId Identifier unique among participating workers
+     */
+    DistributedSync(const std::string& syncDirectory, int workerId);
+
+    /**
+     * @brief Publish sums accumulated since the previous publish
+     *
+     * Writes the difference between `current` and the baseline captured
+     * at the previous publish, then advances the baseline. Nodes whose
+     * sums did not change are skipped.
+     *
+     * @param current The worker's node map
+     * @return Number of node deltas published
+     */
+    std::size_t publishDelta(const FlatNodeMap& current);
+
+    /**
+     * @brief Merge unconsumed deltas from other workers
+     *
+     * Scans the sync directory and additively merges every delta file
+     * from other workers that has not been applied yet, in epoch order.
+     * Also merges the published sums into the local baseline so they are
+     * not re-published as this worker's own progress.
+     *
+     * @param target The worker's node map
+     * @return Number of delta files merged
+     */
+    std::size_t mergeRemoteDeltas(FlatNodeMap& target);
+
+    /**
+     * @brief Epoch of the next publish (number of publishes so far)
+     */
+    int currentEpoch() const noexcept { return epoch_; }
+
+private:
+    std::string syncDirectory_;
+    int workerId_;
+    int epoch_ = 0;
+
+    /// Sums already accounted for (own publishes and merged remote deltas)
+    FlatNodeMap baseline_;
+
+    /// Last epoch consumed per remote worker id
+    std::unordered_map<int, int> consumedEpochs_;
+
+    /**
+     * @brief Delta file path for a (worker, epoch) pair
+     */
+    std::string deltaPath(int workerId, int epoch) const;
+
+    /**
+     * @brief Write one delta file (atomic via temp file + rename)
+     */
+    std::size_t writeDeltaFile(const std::string& path,
+                               const FlatNodeMap& current) const;
+
+    /**
+     * @brief Merge one delta file into a map (and the baseline)
+     */
+    bool applyDeltaFile(const std::string& path, FlatNodeMap& target);
+};
+
+} // namespace mccfr
@@ -0,0 +1,179 @@
+#pragma once
+
+#include "node.hpp"
+#include "info_set_key.hpp"
+#include <functional>
+#include <vector>
+#include <cstdint>
+
+namespace mccfr {
+
+/**
+ * @brief Open-addressing hash table from packed information set keys to nodes
+ *
+ * Replaces std::unordered_map<std::string, Node> on the training hot path:
+ * keys are 64-bit integers hashed with a single multiply-xor mix, slots are
+ * probed linearly in one contiguous array, and no per-entry allocation or
+ * string hashing happens on lookup. Grows by doubling at 70% load.
+ */
+class FlatNodeMap {
+public:
+    /**
+     * @brief Construct map with given initial capacity (rounded up to a power of two)
+     */
+    explicit FlatNodeMap(std::size_t initialCapacity = 1024);
+
+    /**
+     * @brief Get node for a key, creating it if absent
+     * @param key Packed information set key
+     * @param numActions Number of actions used when creating a new node
+     */
+    Node& getOrCreate(InfoSetKey key, int numActions);
+
+    /**
+     * @brief Find node for a key
+     * @return Pointer to node, or nullptr if absent
+     */
+    Node* find(InfoSetKey key) noexcept;
+    const Node* find(InfoSetKey key) const noexcept;
+
+    /**
+     * @brief Number of stored nodes
+     */
+    std::size_t size() const noexcept { return size_; }
+
+    /**
+     * @brief Check whether the map is empty
+     */
+    bool empty() const noexcept { return size_ == 0; }
+
+    /**
+     * @brief Remove all nodes
+     */
+    void clear();
+
+    /**
+     * @brief Ensure capacity for at least `count` nodes without rehashing
+     */
+    void reserve(std::size_t count);
+
+    /// Callback run once on each newly created node
+    using NodeInitializer = std::function<void(InfoSetKey, Node&)>;
+
+    /**
+     * @brief Install a callback that seeds every node getOrCreate creates
+     *
+     * Used for warm starts: the trainer seeds fresh nodes from a prior
+     * strategy the moment they first appear. Only creation pays the
+     * call; lookups of existing nodes are unaffected. Pass an empty
+     * function to remove the hook.
+     */
+    void setNodeInitializer(NodeInitializer initializer) {
+        initializer_ = std::move(initializer);
+    }
+
+    /**
+     * @brief Resident bytes held by the slot array
+     *
+     * The map's entire footprint is the contiguous slot vector (keys are
+     * packed 64-bit integers, nodes are inline), so this is the number
+     * the memory-budget enforcement compares against.
+     */
+    std::size_t memoryBytes() const noexcept {
+        return slots_.capacity() * sizeof(Slot);
+    }
+
+    /**
+     * @brief Remove every node matching a predicate and shrink to fit
+     *
+     * Open addressing cannot tombstone cheaply, so the survivors are
+     * rehashed into a fresh slot array sized for them; memoryBytes()
+     * drops accordingly.
+     *
+     * @param pred Callable taking (InfoSetKey, const Node&), true = remove
+     * @return Number of nodes removed
+     */
+    template <typename Pred>
+    std::size_t eraseIf(Pred&& pred) {
+        std::vector<Slot> oldSlots = std::move(slots_);
+
+        std::size_t survivors = 0;
+        for (auto& slot : oldSlots) {
+            if (slot.occupied && pred(slot.key, slot.node)) {
+                slot.occupied = false;
+            } else if (slot.occupied) {
+                ++survivors;
+            }
+        }
+        std::size_t removed = size_ - survivors;
+
+        slots_.assign(roundUpCapacity(survivors * 10 / 7 + 1), Slot{});
+        size_ = 0;
+        for (auto& slot : oldSlots) {
+            if (slot.occupied) {
+                Slot& target = slots_[probeSlot(slot.key)];
+                target.key = slot.key;
+                target.node = std::move(slot.node);
+                target.occupied = true;
+                ++size_;
+            }
+        }
+        return removed;
+    }
+
+    /**
+     * @brief Visit every (key, node) pair
+     * @param visitor Callable taking (InfoSetKey, Node&) or (InfoSetKey, const Node&)
+     */
+    template <typename Visitor>
+    void forEach(Visitor&& visitor) {
+        for (auto& slot : slots_) {
+            if (slot.occupied) {
+                visitor(slot.key, slot.node);
+            }
+        }
+    }
+
+    template <typename Visitor>
+    void forEach(Visitor&& visitor) const {
+        for (const auto& slot : slots_) {
+            if (slot.occupied) {
+                visitor(slot.key, slot.node);
+            }
+        }
+    }
+
+private:
+    struct Slot {
+        InfoSetKey key = 0;
+        Node node;
+        bool occupied = false;
+    };
+
+    std::vector<Slot> slots_;
+    std::size_t size_ = 0;
+    NodeInitializer initializer_;
+
+    /**
+     * @brief Mix a key into a well-distributed slot index basis
+     */
+    static std::size_t hashKey(InfoSetKey key) noexcept;
+
+    /**
+     * @brief Find the slot index holding `key`, or the first free slot in
+     *        its probe sequence
+     */
+    std::size_t probeSlot(InfoSetKey key) const noexcept;
+
+    /**
+     * @brief Double the slot array and reinsert all nodes
+     */
+    void grow();
+
+    /**
+     * @brief Round a capacity up to the next power of two (minimum 16)
+     */
+    static std::size_t roundUpCapacity(std::size_t capacity) noexcept;
+};
+
+} // namespace mccfr
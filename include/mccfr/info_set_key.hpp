@@ -0,0 +1,141 @@
+#pragma once
+
+#include "../aof/game_state.hpp"
+#include <string>
+#include <cstdint>
+
+namespace mccfr {
+
+/**
+ * @brief Information set packed into a single 64-bit integer
+ *
+ * Replaces the string identifiers built by utils::getInformationSet on the
+ * training hot path. Layout (low to high bits):
+ *  - bits 0-1:   acting player position (0-3)
+ *  - bits 2-9:   four 2-bit status fields, one per position
+ *                (0 = not visible to the acting player, 1 = pending,
+ *                 2 = folded, 3 = all-in)
+ *  - bits 10-17: hole-card bucket id (one of the 169 preflop classes)
+ *  - bits 18-37: pot size in tenths of a chip
+ *
+ * The visibility rule matches the string form: blinds (players 0-1) see
+ * every other position's status, later positions only see players who
+ * acted before them.
+ */
+using InfoSetKey = std::uint64_t;
+
+namespace utils {
+
+/**
+ * @brief Get the canonical preflop bucket id for two hole cards
+ *
+ * Buckets follow the standard 13x13 grid: pairs on the diagonal, suited
+ * combinations above it, offsuit below, giving ids in [0, 169).
+ *
+ * @param card1 First hole card
+ * @param card2 Second hole card
+ * @return Bucket id in [0, 169)
+ */
+int holeBucketId(const aof::Card& card1, const aof::Card& card2) noexcept;
+
+/**
+ * @brief Get display label for a hole-card bucket ("AKs", "T9o", "77", ...)
+ * @param bucketId Bucket id in [0, 169)
+ * @return Label matching abstractHoleCards output
+ */
+const std::string& holeBucketLabel(int bucketId);
+
+/**
+ * @brief Encode a player's information set as a packed 64-bit key
+ *
+ * Integer counterpart of getInformationSet; the same game situations
+ * collapse to the same key as collapse to the same string.
+ *
+ * @param state Current game state (hole cards must be dealt)
+ * @param player Player index (0-3)
+ * @return Packed information set key
+ */
+InfoSetKey encodeInfoSet(const aof::GameState& state, int player);
+
+/**
+ * @brief Encode an information set from structured observations
+ *
+ * Builds the same packed key as the GameState overload from the inputs
+ * a live decision service has at hand: seat, observed status masks, the
+ * player's two hole cards and the pot. The visibility rule is applied
+ * here, so callers pass the full table masks.
+ *
+ * @param player Acting player position (0-3)
+ * @param foldedMask Bit p set = player p has folded
+ * @param allInMask Bit p set = player p is all-in
+ * @param card1 First hole card of the acting player
+ * @param card2 Second hole card of the acting player
+ * @param pot Current pot size in chips
+ * @return Packed information set key
+ */
+InfoSetKey encodeInfoSet(int player, std::uint8_t foldedMask,
+                         std::uint8_t allInMask, const aof::Card& card1,
+                         const aof::Card& card2, double pot);
+
+/**
+ * @brief Extract the acting player position from a packed key
+ * @param key Packed information set key
+ * @return Position in [0, 3]
+ */
+int keyPosition(InfoSetKey key) noexcept;
+
+/**
+ * @brief Extract the hole-card bucket id from a packed key
+ * @param key Packed information set key
+ * @return Bucket id in [0, 169)
+ */
+int keyBucket(InfoSetKey key) noexcept;
+
+/**
+ * @brief Extract the four packed 2-bit status fields from a packed key
+ * @param key Packed information set key
+ * @return Status bits as stored in the key (position p at bits 2p-2p+1)
+ */
+std::uint8_t keyStatusBits(InfoSetKey key) noexcept;
+
+/**
+ * @brief Clear the pot field of a packed key
+ *
+ * The remaining bits (position, status pattern, hole-card bucket) are
+ * the fields that stay comparable across game configurations, so this
+ * is the matching key for transferring strategies between them.
+ *
+ * @param key Packed information set key
+ * @return Key with the pot bits zeroed
+ */
+InfoSetKey keyStructure(InfoSetKey key) noexcept;
+
+/**
+ * @brief Extract the pot size from a packed key
+ * @param key Packed information set key
+ * @return Pot size in chips (stored in tenths)
+ */
+double keyPot(InfoSetKey key) noexcept;
+
+/**
+ * @brief Reconstruct the human-readable string form of a packed key
+ *
+ * Produces the same format as getInformationSet
+ * (e.g. "P2:[P0:F][P1:A]AKs Pot:2.4") for strategy export and debugging.
+ *
+ * @param key Packed information set key
+ * @return Information set string
+ */
+std::string decodeInfoSetString(InfoSetKey key);
+
+/**
+ * @brief Parse an information set string back into its packed key
+ * @param infoSet String as produced by getInformationSet/decodeInfoSetString
+ * @param key Output packed key
+ * @return True if the string was recognized
+ */
+bool parseInfoSetString(const std::string& infoSet, InfoSetKey& key);
+
+} // namespace utils
+
+} // namespace mccfr
@@ -0,0 +1,162 @@
+#pragma once
+
+#include "strategy_file_format.hpp"
+#include <string>
+#include <vector>
+
+namespace mccfr {
+
+/**
+ * @brief One strategy entry as served from a mapped file
+ *
+ * The strategy pointer aims into the mapping and stays valid until the
+ * file is closed.
+ */
+struct StrategyEntryView {
+    InfoSetKey key = 0;             ///< Packed information set key
+    std::uint64_t visitCount = 0;   ///< Training visits recorded for the entry
+    const double* strategy = nullptr;  ///< numActions() probabilities
+};
+
+/**
+ * @brief Read-only view of a memory-mapped binary strategy file
+ *
+ * Maps a version-2 strategy file (see strategy_file_format.hpp) and
+ * serves lookups directly from the mapping: no parsing, no per-entry
+ * allocation, and the first query is answered as soon as open() returns.
+ * Multiple bot processes mapping the same file share its pages.
+ *
+ * Lookup is O(1): hash the packed key into the embedded index and probe
+ * linearly; findStrategy returns a pointer into the mapping that stays
+ * valid until close().
+ */
+class MappedStrategyFile {
+public:
+    MappedStrategyFile() = default;
+    ~MappedStrategyFile();
+
+    // The mapping is owned exclusively; moving is fine, copying is not
+    MappedStrategyFile(const MappedStrategyFile&) = delete;
+    MappedStrategyFile& operator=(const MappedStrategyFile&) = delete;
+    MappedStrategyFile(MappedStrategyFile&& other) noexcept;
+    MappedStrategyFile& operator=(MappedStrategyFile&& other) noexcept;
+
+    /**
+     * @brief Map a strategy file
+     * @param filename File written by StrategyManager::saveToBinary
+     * @return True if the file was mapped and its header validated
+     */
+    bool open(const std::string& filename);
+
+    /**
+     * @brief Unmap the file (lookups become invalid)
+     */
+    void close();
+
+    /**
+     * @brief Check whether a file is currently mapped
+     */
+    bool isOpen() const noexcept { return mapping_ != nullptr; }
+
+    /**
+     * @brief Get number of stored strategies
+     */
+    std::size_t size() const noexcept;
+
+    /**
+     * @brief Get number of action probabilities per strategy
+     */
+    int numActions() const noexcept;
+
+    /**
+     * @brief Look up a strategy by packed key
+     * @param key Packed information set key
+     * @return Pointer to numActions() probabilities inside the mapping,
+     *         or nullptr if the key is not present
+     */
+    const double* findStrategy(InfoSetKey key) const noexcept;
+
+    /**
+     * @brief Get visit count recorded for an information set
+     * @param key Packed information set key
+     * @return Visit count, or 0 if the key is not present
+     */
+    std::uint64_t getVisitCount(InfoSetKey key) const noexcept;
+
+    /**
+     * @brief Look up a strategy by information set string
+     * @param infoSet Information set identifier
+     * @return Strategy vector, or empty if not found
+     */
+    std::vector<double> getStrategy(const std::string& infoSet) const;
+
+    /**
+     * @brief Whether the file carries the embedded analytics index
+     *
+     * Files written before the index existed open fine but answer the
+     * queries below with empty results.
+     */
+    bool hasAnalyticsIndex() const noexcept { return byVisits_ != nullptr; }
+
+    /**
+     * @brief Get the k most-visited entries, most visited first
+     *
+     * A prefix read of the visit-order index: no scan, no sort.
+     *
+     * @param k Maximum number of entries to return
+     * @return Up to k entries in descending visit order
+     */
+    std::vector<StrategyEntryView> topByVisits(std::size_t k) const;
+
+    /**
+     * @brief Get entries matching structured key fields
+     *
+     * Position and position+bucket filters are contiguous ranges of the
+     * field-order index found by binary search; a bucket filter without
+     * a position binary-searches once per position. Results come back
+     * ordered by (position, bucket, pot).
+     *
+     * @param position Acting player position, or -1 for any
+     * @param bucket Hole-card bucket id, or -1 for any
+     * @param minPot Minimum pot size in chips (0 = no pot filter)
+     * @return Matching entries
+     */
+    std::vector<StrategyEntryView> filterEntries(int position, int bucket,
+                                                 double minPot = 0.0) const;
+
+    /**
+     * @brief Average probability of one action per hole-card bucket
+     *
+     * One pass over the entry array (e.g. actionIndex 1 gives the
+     * average all-in frequency per bucket); buckets with no entries
+     * report 0.
+     *
+     * @param actionIndex Action column in [0, numActions())
+     * @return One unweighted average per bucket id in [0, 169)
+     */
+    std::vector<double> averageActionFrequencyByBucket(int actionIndex) const;
+
+private:
+    void* mapping_ = nullptr;
+    std::size_t mappingSize_ = 0;
+    const strategy_file::Header* header_ = nullptr;
+    const strategy_file::IndexSlot* slots_ = nullptr;
+    const char* entries_ = nullptr;
+    const std::uint64_t* byVisits_ = nullptr;  ///< Entry order by descending visits
+    const std::uint64_t* byField_ = nullptr;   ///< Entry order by (position, bucket, pot)
+
+    /**
+     * @brief Find the entry header for a key via the embedded index
+     * @param key Packed information set key
+     * @return Entry header inside the mapping, or nullptr if absent
+     */
+    const strategy_file::EntryHeader* findEntry(InfoSetKey key) const noexcept;
+
+    /**
+     * @brief Build a view of the entry at a dense array index
+     * @param index Entry index in [0, entryCount)
+     */
+    StrategyEntryView entryView(std::uint64_t index) const noexcept;
+};
+
+} // namespace mccfr
@@ -1,49 +1,224 @@
 #pragma once
 
+#include <array>
+#include <cmath>
 #include <vector>
 #include <string>
 #include <cstdint>
+#include <stdexcept>
 
 namespace mccfr {
 
+/**
+ * @brief Regret/strategy update variants
+ */
+enum class UpdateRule {
+    /// Plain cumulative regret with vanilla regret matching
+    VANILLA,
+    /// CFR+: regrets floored at zero, strategy sums weighted linearly
+    /// by the iteration so late (better) strategies dominate the average
+    CFR_PLUS,
+    /// Discounted CFR: cumulative sums decay by the alpha/beta/gamma
+    /// schedule, applied lazily when a node is first touched in an
+    /// iteration (nodes are not visited every iteration under sampling)
+    DISCOUNTED
+};
+
+/**
+ * @brief Per-iteration parameters for the node update rule
+ *
+ * Built once per iteration by the trainer and passed down the
+ * traversal, so nodes stay free of training configuration.
+ */
+struct UpdatePolicy {
+    UpdateRule rule = UpdateRule::VANILLA;  ///< Selected update variant
+    int iteration = 1;                      ///< Current training iteration (1-based)
+    double alpha = 1.5;                     ///< Positive-regret discount exponent (DISCOUNTED)
+    double beta = 0.0;                      ///< Negative-regret discount exponent (DISCOUNTED)
+    double gamma = 2.0;                     ///< Strategy-sum discount exponent (DISCOUNTED)
+    /// Skip trained-player subtrees whose action regret is below
+    /// pruneThreshold this iteration (false on re-exploration iterations)
+    bool pruneEnabled = false;
+    double pruneThreshold = -300.0;         ///< Cumulative regret below which a branch is skipped
+};
+
 /**
  * @brief Represents an information set node in the MCCFR algorithm
- * 
+ *
  * Each node tracks regret sums and cumulative strategies for a specific
  * information set (game situation from a player's perspective).
+ *
+ * Storage is a pair of inline fixed-capacity arrays sized at compile time,
+ * so a node is a single flat object with no heap blocks of its own. Node
+ * maps that keep nodes by value (FlatNodeMap's slot array, the sharded
+ * map's per-shard tables) therefore act as contiguous pools and regret
+ * updates stay cache-resident during traversal. Hot paths should use the
+ * caller-buffer overloads of getStrategy/getAverageStrategy; the
+ * vector-returning overloads remain for save/analysis code.
  */
-class Node {
+template <int MaxActions>
+class BasicNode {
 public:
+    /// Compile-time action capacity; callers can size stack buffers with it
+    static constexpr int MAX_ACTIONS = MaxActions;
+
+    static_assert(MaxActions > 0, "Node capacity must be positive");
+
     /**
      * @brief Construct node with specified number of actions
      * @param numActions Number of legal actions at this information set
      */
-    explicit Node(int numActions);
+    explicit BasicNode(int numActions)
+        : numActions_(numActions)
+    {
+        if (numActions <= 0 || numActions > MaxActions) {
+            throw std::invalid_argument("Number of actions must be in [1, MAX_ACTIONS]");
+        }
+    }
 
     /**
      * @brief Default constructor (creates node with 3 actions for AoF)
      */
-    Node();
+    BasicNode() : BasicNode(3) {}  // FOLD, ALL_IN, DEAL
+
+    /**
+     * @brief Number of legal actions at this information set
+     */
+    int numActions() const noexcept { return numActions_; }
+
+    /**
+     * @brief Get current strategy based on regret matching
+     *
+     * Allocation-free variant for the traversal hot path.
+     *
+     * @param realizationWeight Weight for updating cumulative strategy
+     * @param out Caller buffer receiving numActions() probabilities
+     */
+    void getStrategy(double realizationWeight, double* out) {
+        ++visitCount_;
+
+        normalizeStrategy(out);
+
+        // Update cumulative strategy
+        for (int i = 0; i < numActions_; ++i) {
+            strategySum_[i] += realizationWeight * out[i];
+        }
+    }
+
+    /**
+     * @brief Get current strategy under a specific update rule
+     *
+     * Same as getStrategy above, but applies the policy's discounting
+     * before reading the regrets and weights the cumulative-strategy
+     * contribution per the selected rule.
+     *
+     * @param realizationWeight Weight for updating cumulative strategy
+     * @param out Caller buffer receiving numActions() probabilities
+     * @param policy Update rule and current iteration
+     */
+    void getStrategy(double realizationWeight, double* out,
+                     const UpdatePolicy& policy) {
+        applyDiscount(policy);
+
+        double weight = realizationWeight;
+        if (policy.rule == UpdateRule::CFR_PLUS) {
+            weight *= static_cast<double>(policy.iteration);
+        }
+        getStrategy(weight, out);
+    }
 
     /**
      * @brief Get current strategy based on regret matching
      * @param realizationWeight Weight for updating cumulative strategy
      * @return Current mixed strategy (probability distribution over actions)
      */
-    std::vector<double> getStrategy(double realizationWeight);
+    std::vector<double> getStrategy(double realizationWeight) {
+        std::vector<double> strategy(numActions_);
+        getStrategy(realizationWeight, strategy.data());
+        return strategy;
+    }
+
+    /**
+     * @brief Get average strategy over all iterations
+     *
+     * Allocation-free variant for the traversal hot path.
+     *
+     * @param out Caller buffer receiving numActions() probabilities
+     */
+    void getAverageStrategy(double* out) const {
+        double sum = 0.0;
+        for (int i = 0; i < numActions_; ++i) {
+            sum += strategySum_[i];
+        }
+
+        if (sum > 0) {
+            for (int i = 0; i < numActions_; ++i) {
+                out[i] = strategySum_[i] / sum;
+            }
+        } else {
+            // Uniform distribution if no strategy accumulated
+            double uniform = 1.0 / numActions_;
+            for (int i = 0; i < numActions_; ++i) {
+                out[i] = uniform;
+            }
+        }
+    }
 
     /**
      * @brief Get average strategy over all iterations
      * @return Time-averaged strategy
      */
-    std::vector<double> getAverageStrategy() const;
+    std::vector<double> getAverageStrategy() const {
+        std::vector<double> avgStrategy(numActions_);
+        getAverageStrategy(avgStrategy.data());
+        return avgStrategy;
+    }
 
     /**
      * @brief Update regret for a specific action
      * @param action Action index
      * @param regret Regret value to add
      */
-    void updateRegret(int action, double regret);
+    void updateRegret(int action, double regret) {
+        if (action < 0 || action >= numActions_) {
+            throw std::invalid_argument("Invalid action index");
+        }
+
+        regretSum_[action] += regret;
+    }
+
+    /**
+     * @brief Update regret for a specific action under a specific rule
+     * @param action Action index
+     * @param regret Regret value to add
+     * @param policy Update rule and current iteration
+     */
+    void updateRegret(int action, double regret, const UpdatePolicy& policy) {
+        updateRegret(action, regret);
+        if (policy.rule == UpdateRule::CFR_PLUS && regretSum_[action] < 0.0) {
+            regretSum_[action] = 0.0;
+        }
+    }
+
+    /**
+     * @brief Add externally accumulated sums into this node
+     *
+     * Used when merging regrets trained elsewhere (another worker's delta
+     * file, another shard) into this node. Regret matching is linear in
+     * the sums, so additive merging keeps the update rule intact.
+     *
+     * @param regretDelta numActions() regret sum increments
+     * @param strategyDelta numActions() strategy sum increments
+     * @param visitDelta Visit count increment
+     */
+    void accumulate(const double* regretDelta, const double* strategyDelta,
+                    std::uint64_t visitDelta) {
+        for (int i = 0; i < numActions_; ++i) {
+            regretSum_[i] += regretDelta[i];
+            strategySum_[i] += strategyDelta[i];
+        }
+        visitCount_ += visitDelta;
+    }
 
     /**
      * @brief Get number of times this node was visited
@@ -53,23 +228,88 @@ public:
     /**
      * @brief Reset all statistics (for testing/retraining)
      */
-    void reset();
+    void reset() {
+        regretSum_.fill(0.0);
+        strategySum_.fill(0.0);
+        visitCount_ = 0;
+    }
 
-    // Direct access for serialization/analysis
-    const std::vector<double>& getRegretSum() const noexcept { return regretSum_; }
-    const std::vector<double>& getStrategySum() const noexcept { return strategySum_; }
+    // Direct access for serialization/analysis; only the first
+    // numActions() entries are meaningful
+    const std::array<double, MaxActions>& getRegretSum() const noexcept { return regretSum_; }
+    const std::array<double, MaxActions>& getStrategySum() const noexcept { return strategySum_; }
 
 private:
-    std::vector<double> regretSum_;     ///< Cumulative regret for each action
-    std::vector<double> strategy_;      ///< Current strategy (working buffer)
-    std::vector<double> strategySum_;   ///< Cumulative strategy for averaging
-    std::uint64_t visitCount_;          ///< Number of times node was visited
+    std::array<double, MaxActions> regretSum_{};    ///< Cumulative regret for each action
+    std::array<double, MaxActions> strategySum_{};  ///< Cumulative strategy for averaging
+    std::uint64_t visitCount_ = 0;                  ///< Number of times node was visited
+    std::uint64_t lastIteration_ = 0;               ///< Last iteration a discount was applied
+    int numActions_ = 3;                            ///< Legal actions actually in use
+
+    /**
+     * @brief Apply the discounted-CFR decay once per touched iteration
+     *
+     * Positive regrets shrink by t^alpha / (t^alpha + 1), negative ones
+     * by t^beta / (t^beta + 1), and strategy sums by (t / (t + 1))^gamma.
+     * Out-of-order iterations (parallel workers) skip the decay rather
+     * than applying it twice.
+     *
+     * @param policy Update rule and current iteration
+     */
+    void applyDiscount(const UpdatePolicy& policy) {
+        if (policy.rule != UpdateRule::DISCOUNTED) {
+            return;
+        }
+
+        auto t = static_cast<std::uint64_t>(policy.iteration);
+        if (t <= lastIteration_) {
+            return;
+        }
+        lastIteration_ = t;
+
+        double iter = static_cast<double>(t);
+        double posPow = std::pow(iter, policy.alpha);
+        double negPow = std::pow(iter, policy.beta);
+        double positiveFactor = posPow / (posPow + 1.0);
+        double negativeFactor = negPow / (negPow + 1.0);
+        double strategyFactor = std::pow(iter / (iter + 1.0), policy.gamma);
+
+        for (int i = 0; i < numActions_; ++i) {
+            regretSum_[i] *= (regretSum_[i] > 0.0) ? positiveFactor
+                                                   : negativeFactor;
+            strategySum_[i] *= strategyFactor;
+        }
+    }
 
     /**
      * @brief Normalize strategy using regret matching
+     * @param strategy Buffer receiving numActions() probabilities
      */
-    void normalizeStrategy();
+    void normalizeStrategy(double* strategy) const {
+        // Use regret matching: positive regrets become strategy weights
+        double normalizingSum = 0.0;
+
+        for (int i = 0; i < numActions_; ++i) {
+            strategy[i] = regretSum_[i] > 0.0 ? regretSum_[i] : 0.0;
+            normalizingSum += strategy[i];
+        }
+
+        // Normalize to probability distribution
+        if (normalizingSum > 0) {
+            for (int i = 0; i < numActions_; ++i) {
+                strategy[i] /= normalizingSum;
+            }
+        } else {
+            // Uniform distribution if all regrets are non-positive
+            double uniform = 1.0 / numActions_;
+            for (int i = 0; i < numActions_; ++i) {
+                strategy[i] = uniform;
+            }
+        }
+    }
 };
 
-} // namespace mccfr
+/// AoF decision nodes never see more than FOLD, ALL_IN and DEAL
+using Node = BasicNode<3>;
 
+} // namespace mccfr
@@ -5,34 +5,56 @@
 
 #pragma once
 
+#include "spsc_ring_buffer.hpp"
+#include "../aof/game_config.hpp"
+#include <array>
 #include <vector>
 #include <string>
 #include <thread>
 #include <atomic>
+#include <memory>
 #include <mutex>
-#include <condition_variable>
-#include <deque>
 #include <chrono>
 
 namespace mccfr {
 
+namespace shm_telemetry {
+class ShmTelemetryWriter;
+} // namespace shm_telemetry
+
 /**
  * @brief Training data point for real-time visualization
+ *
+ * Fixed-size and trivially copyable so it can travel through the
+ * lock-free ring buffer without touching the heap: utilities live in an
+ * inline array and elapsed time is stored as plain milliseconds.
  */
 struct TrainingDataPoint {
-    int iteration;
-    double meanAbsoluteError;
-    double utilitySum;
-    std::vector<double> playerUtilities;
-    std::chrono::milliseconds elapsedTime;
-    
-    TrainingDataPoint(int iter, double mae, double sum, 
-                     const std::vector<double>& utilities, 
+    std::int32_t iteration = 0;
+    std::int32_t numPlayers = 0;
+    double meanAbsoluteError = 0.0;
+    double utilitySum = 0.0;
+    std::array<double, aof::GameConfig::NUM_PLAYERS> playerUtilities{};
+    std::int64_t elapsedMs = 0;
+
+    TrainingDataPoint() = default;
+
+    TrainingDataPoint(int iter, double mae, double sum,
+                     const std::vector<double>& utilities,
                      std::chrono::milliseconds elapsed)
-        : iteration(iter), meanAbsoluteError(mae), utilitySum(sum), 
-          playerUtilities(utilities), elapsedTime(elapsed) {}
+        : iteration(iter), meanAbsoluteError(mae), utilitySum(sum),
+          elapsedMs(elapsed.count()) {
+        numPlayers = static_cast<std::int32_t>(
+            std::min<std::size_t>(utilities.size(), playerUtilities.size()));
+        for (std::int32_t i = 0; i < numPlayers; ++i) {
+            playerUtilities[i] = utilities[i];
+        }
+    }
 };
 
+static_assert(std::is_trivially_copyable<TrainingDataPoint>::value,
+              "TrainingDataPoint must stay POD for the ring buffer");
+
 /**
  * @brief Real-time data streamer for MCCFR training visualization
  * 
@@ -51,6 +73,11 @@ public:
         int maxDataPoints = 1000;                ///< Maximum data points to keep
         bool showConsoleStats = true;            ///< Show stats in console
         std::string windowTitle = "MCCFR Training"; ///< Visualization window title
+        bool enableWebServer = true;             ///< Serve the browser dashboard on port 8080
+        /// Shared-memory telemetry ring file ("" = off). Every data point
+        /// is additionally published into this mapping with a single
+        /// memcpy on the training thread, for visualizer.py --live
+        std::string sharedMemoryFile;
     };
 
     /**
@@ -77,6 +104,12 @@ public:
     
     /**
      * @brief Add a new data point for visualization
+     *
+     * Wait-free for the training thread: the point goes into a bounded
+     * lock-free ring buffer and the visualization thread does all
+     * serialization and printing. If the consumer falls behind, the
+     * oldest points are dropped rather than ever stalling training.
+     *
      * @param dataPoint The training data point to visualize
      */
     void addDataPoint(const TrainingDataPoint& dataPoint);
@@ -98,11 +131,17 @@ private:
     std::atomic<bool> running_{false};
     std::atomic<bool> shouldStop_{false};
     std::thread visualizationThread_;
-    std::mutex dataMutex_;
-    std::condition_variable dataCondition_;
-    
-    // Data storage
-    std::deque<TrainingDataPoint> dataPoints_;
+
+    /// Capacity of the producer/consumer hand-off buffer (power of two)
+    static constexpr std::size_t QUEUE_CAPACITY = 1024;
+
+    // Data hand-off from the training thread (single producer) to the
+    // visualization thread (single consumer)
+    SpscRingBuffer<TrainingDataPoint, QUEUE_CAPACITY> dataQueue_;
+
+    /// Shared-memory ring published directly from the training thread
+    /// (null when Config::sharedMemoryFile is empty)
+    std::unique_ptr<shm_telemetry::ShmTelemetryWriter> shmWriter_;
     
     // Visualization methods
     void visualizationLoop();
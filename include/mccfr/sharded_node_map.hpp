@@ -0,0 +1,98 @@
+#pragma once
+
+#include "node.hpp"
+#include "flat_node_map.hpp"
+#include <unordered_map>
+#include <array>
+#include <mutex>
+
+namespace mccfr {
+
+/**
+ * @brief Concurrent node storage striped across independently locked shards
+ *
+ * Used by the multi-threaded training path so worker threads updating
+ * different information sets do not serialize on a single map-wide lock.
+ * Keys are packed information set integers distributed across shards by
+ * a mixed hash; each shard owns its own map and mutex, so contention only
+ * occurs when two threads touch information sets that land in the same
+ * shard.
+ */
+class ShardedNodeMap {
+public:
+    /// Number of independent shards (power of two for cheap index masking)
+    static constexpr std::size_t NUM_SHARDS = 64;
+
+    /**
+     * @brief Handle to a node with its shard lock held (RAII)
+     *
+     * The referenced node is only valid while the lock is held. Do not
+     * keep the handle across calls that may touch other shards.
+     */
+    struct LockedNode {
+        Node& node;
+        std::unique_lock<std::mutex> lock;
+    };
+
+    /**
+     * @brief Get node for an information set, creating it if absent
+     * @param key Packed information set key
+     * @param numActions Number of actions used when creating a new node
+     * @return Locked handle to the node
+     */
+    LockedNode getOrCreate(InfoSetKey key, int numActions);
+
+    /**
+     * @brief Install a callback that seeds every node getOrCreate creates
+     *
+     * Counterpart of FlatNodeMap::setNodeInitializer for the parallel
+     * path; the callback runs under the creating shard's lock, so it
+     * must not touch other shards. Install before workers start.
+     */
+    void setNodeInitializer(FlatNodeMap::NodeInitializer initializer) {
+        initializer_ = std::move(initializer);
+    }
+
+    /**
+     * @brief Get total number of nodes across all shards
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Move all nodes into a flat node map
+     *
+     * Only call after all worker threads have joined.
+     * @param target Destination map; existing entries are kept
+     */
+    void mergeInto(FlatNodeMap& target);
+
+    /**
+     * @brief Copy all nodes into a flat node map without draining shards
+     *
+     * Takes each shard lock in turn, so it is safe to call while worker
+     * threads are still training; used to snapshot state for checkpoints.
+     * @param target Destination map; existing entries are overwritten
+     */
+    void copyInto(FlatNodeMap& target) const;
+
+    /**
+     * @brief Remove all nodes from all shards
+     */
+    void clear();
+
+private:
+    struct Shard {
+        std::unordered_map<InfoSetKey, Node> nodes;
+        mutable std::mutex mutex;
+    };
+
+    std::array<Shard, NUM_SHARDS> shards_;
+    FlatNodeMap::NodeInitializer initializer_;
+
+    /**
+     * @brief Map a packed key to its shard index
+     */
+    static std::size_t shardIndex(InfoSetKey key) noexcept;
+};
+
+} // namespace mccfr
@@ -0,0 +1,162 @@
+/**
+ * @file shm_telemetry.hpp
+ * @brief Shared-memory ring of training data points for external consumers
+ */
+
+#pragma once
+
+#include "realtime_visualizer.hpp"
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace mccfr {
+namespace shm_telemetry {
+
+/// File magic identifying a telemetry ring mapping ("AOFSHMRG")
+constexpr char MAGIC[8] = {'A', 'O', 'F', 'S', 'H', 'M', 'R', 'G'};
+
+/// Bumped whenever the header or record layout changes
+constexpr std::uint32_t VERSION = 1;
+
+/**
+ * @brief Header at offset 0 of a telemetry ring mapping
+ *
+ * The header is followed immediately by `capacity` fixed-size
+ * TrainingDataPoint slots. `sequence` counts records ever published; the
+ * record with sequence number s lives in slot s % capacity, so the ring
+ * always holds the most recent `capacity` records and a reader that
+ * falls further behind simply skips forward. The writer publishes with a
+ * single memcpy into the slot followed by a release-store of `sequence`;
+ * readers acquire-load `sequence`, copy the slot, then re-check
+ * `sequence` to discard the copy if the writer lapped them mid-read.
+ *
+ * The layout is consumed from Python (visualizer.py --live), so every
+ * field is explicitly sized and the whole header is padded to one cache
+ * line.
+ */
+struct RingHeader {
+    char magic[8];                        ///< MAGIC
+    std::uint32_t version;                ///< VERSION
+    std::uint32_t recordSize;             ///< sizeof(TrainingDataPoint)
+    std::uint64_t capacity;               ///< Record slots (power of two)
+    std::atomic<std::uint64_t> sequence;  ///< Records ever published
+    std::uint8_t reserved[32];            ///< Zero; reserved for later use
+};
+
+static_assert(sizeof(RingHeader) == 64, "ring header layout is part of the file format");
+static_assert(sizeof(TrainingDataPoint) == 64,
+              "record layout is part of the file format shared with visualizer.py");
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+              "the sequence counter must be a plain lock-free word in shared memory");
+
+/**
+ * @brief Single-producer writer side of a telemetry ring
+ *
+ * Creates and maps the backing file once up front; after that, publishing
+ * a point is one memcpy and one release-store with no syscalls, so the
+ * training thread can stream thousands of points per second at no
+ * measurable cost. Place the file on a memory-backed filesystem
+ * (e.g. /dev/shm) to keep the kernel from ever writing it back.
+ */
+class ShmTelemetryWriter {
+public:
+    ShmTelemetryWriter() = default;
+    ~ShmTelemetryWriter();
+
+    ShmTelemetryWriter(const ShmTelemetryWriter&) = delete;
+    ShmTelemetryWriter& operator=(const ShmTelemetryWriter&) = delete;
+
+    /**
+     * @brief Create (truncating any previous run) and map the ring file
+     * @param filename Backing file, ideally under /dev/shm
+     * @param capacity Record slots to keep; rounded up to a power of two
+     * @return true on success
+     */
+    bool create(const std::string& filename, std::size_t capacity = 4096);
+
+    /**
+     * @brief Publish one record: memcpy into the next slot, release-store
+     *
+     * Wait-free and syscall-free; silently drops the point when the ring
+     * is not open so call sites need no guard.
+     */
+    void publish(const TrainingDataPoint& point) noexcept;
+
+    /// @brief Whether a mapping is active
+    bool isOpen() const { return header_ != nullptr; }
+
+    /// @brief Records published since create()
+    std::uint64_t published() const;
+
+    /**
+     * @brief Unmap the ring; the file stays behind for late readers
+     */
+    void close();
+
+private:
+    void* mapping_ = nullptr;
+    std::size_t mappingSize_ = 0;
+    RingHeader* header_ = nullptr;
+    unsigned char* records_ = nullptr;
+    std::uint64_t capacityMask_ = 0;
+};
+
+/**
+ * @brief Polling reader side of a telemetry ring
+ *
+ * The in-process mirror of what visualizer.py --live does: map the file,
+ * acquire-load the sequence counter, and copy out records the writer has
+ * published since the last poll. A reader that falls more than
+ * `capacity` records behind resumes at the oldest record still in the
+ * ring.
+ */
+class ShmTelemetryReader {
+public:
+    ShmTelemetryReader() = default;
+    ~ShmTelemetryReader();
+
+    ShmTelemetryReader(const ShmTelemetryReader&) = delete;
+    ShmTelemetryReader& operator=(const ShmTelemetryReader&) = delete;
+
+    /**
+     * @brief Map an existing ring file read-only and validate its header
+     * @param filename Ring file written by a ShmTelemetryWriter
+     * @return true when the header is a valid current-version ring
+     */
+    bool open(const std::string& filename);
+
+    /**
+     * @brief Copy out the next unread record, if any
+     *
+     * Skips forward when lapped and retries slots the writer overwrote
+     * mid-copy, so every record returned is intact.
+     *
+     * @param out Filled with the record on success
+     * @return true when a record was read, false when caught up
+     */
+    bool poll(TrainingDataPoint& out);
+
+    /// @brief Whether a mapping is active
+    bool isOpen() const { return header_ != nullptr; }
+
+    /// @brief Records skipped because the writer lapped this reader
+    std::uint64_t droppedRecords() const { return droppedRecords_; }
+
+    /**
+     * @brief Unmap the ring
+     */
+    void close();
+
+private:
+    void* mapping_ = nullptr;
+    std::size_t mappingSize_ = 0;
+    const RingHeader* header_ = nullptr;
+    const unsigned char* records_ = nullptr;
+    std::uint64_t capacity_ = 0;
+    std::uint64_t nextSequence_ = 0;
+    std::uint64_t droppedRecords_ = 0;
+};
+
+} // namespace shm_telemetry
+} // namespace mccfr
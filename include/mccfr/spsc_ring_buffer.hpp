@@ -0,0 +1,149 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+namespace mccfr {
+
+/**
+ * @brief Bounded lock-free single-producer/single-consumer ring buffer
+ *
+ * Built for telemetry hand-off from the training thread to a slow
+ * consumer: push() always succeeds and never blocks or allocates. When
+ * the consumer lags behind by more than the capacity, the producer
+ * simply overwrites the oldest entries (drop-oldest policy) and the
+ * consumer skips ahead, counting what it missed.
+ *
+ * Each slot carries a version counter in seqlock style: the producer
+ * marks the slot odd while writing and even (encoding the item number)
+ * when done, so the consumer can detect a slot that was overwritten
+ * mid-read and discard the torn copy. T must be trivially copyable for
+ * that discard to be safe.
+ *
+ * Exactly one thread may call push() and exactly one thread may call
+ * tryPop(); there is no internal synchronization for more.
+ */
+template <typename T, std::size_t Capacity>
+class SpscRingBuffer {
+    static_assert((Capacity & (Capacity - 1)) == 0,
+                  "Capacity must be a power of two");
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "T must be trivially copyable");
+
+public:
+    SpscRingBuffer() = default;
+
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+    SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+    /**
+     * @brief Append a value, overwriting the oldest entry when full
+     *
+     * Producer thread only. Never blocks, never allocates.
+     * @param value Value to append
+     */
+    void push(const T& value) noexcept {
+        std::uint64_t n = writeCount_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[n & (Capacity - 1)];
+
+        // Odd version: write in progress; even: slot holds item n. The
+        // store-store fence keeps the payload write from being reordered
+        // before the odd marker (a release store only orders what comes
+        // before it), or the reader could validate a torn copy on
+        // weakly-ordered hardware
+        slot.version.store(2 * n + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.value = value;
+        slot.version.store(2 * n + 2, std::memory_order_release);
+
+        writeCount_.store(n + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Pop the oldest available value
+     *
+     * Consumer thread only. Entries overwritten before they could be
+     * read are skipped and recorded in droppedCount().
+     *
+     * @param out Receives the popped value
+     * @return True if a value was popped, false if the buffer was empty
+     */
+    bool tryPop(T& out) noexcept {
+        while (true) {
+            std::uint64_t written = writeCount_.load(std::memory_order_acquire);
+            if (readCount_ >= written) {
+                return false;
+            }
+
+            // Skip entries the producer has already overwritten
+            if (written - readCount_ > Capacity) {
+                std::uint64_t newRead = written - Capacity;
+                dropped_ += newRead - readCount_;
+                readCount_ = newRead;
+            }
+
+            std::uint64_t n = readCount_;
+            Slot& slot = slots_[n & (Capacity - 1)];
+
+            std::uint64_t versionBefore = slot.version.load(std::memory_order_acquire);
+            if (versionBefore != 2 * n + 2) {
+                // Slot no longer holds item n (overwrite in progress or
+                // done); re-resolve the read position and try again
+                ++dropped_;
+                ++readCount_;
+                continue;
+            }
+
+            out = slot.value;
+
+            std::uint64_t versionAfter = slot.version.load(std::memory_order_acquire);
+            if (versionAfter == versionBefore) {
+                ++readCount_;
+                return true;
+            }
+
+            // Torn read: the producer lapped us mid-copy; discard and retry
+            ++dropped_;
+            ++readCount_;
+        }
+    }
+
+    /**
+     * @brief Check whether the buffer currently holds no unread entries
+     *
+     * Consumer thread only (uses the consumer's read position).
+     */
+    bool empty() const noexcept {
+        return readCount_ >= writeCount_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Get number of entries lost to the drop-oldest policy
+     *
+     * Consumer thread only.
+     */
+    std::uint64_t droppedCount() const noexcept { return dropped_; }
+
+    /**
+     * @brief Get buffer capacity
+     */
+    static constexpr std::size_t capacity() noexcept { return Capacity; }
+
+private:
+    struct Slot {
+        std::atomic<std::uint64_t> version{0};
+        T value{};
+    };
+
+    std::array<Slot, Capacity> slots_{};
+    std::atomic<std::uint64_t> writeCount_{0};
+
+    // Consumer-owned state; never touched by the producer
+    std::uint64_t readCount_ = 0;
+    std::uint64_t dropped_ = 0;
+};
+
+} // namespace mccfr
@@ -0,0 +1,133 @@
+#pragma once
+
+#include "info_set_key.hpp"
+#include <cstdint>
+#include <cstddef>
+
+namespace mccfr {
+
+/**
+ * @brief On-disk layout of the binary strategy format (version 2)
+ *
+ * The file is designed to be memory-mapped and served without a parse
+ * step: a fixed-size header is followed by an open-addressing hash index
+ * (power-of-two slot count, linear probing) and a dense array of
+ * fixed-stride entries. All integers are little-endian and all offsets
+ * are absolute byte offsets from the start of the file, so a consumer
+ * can mmap the file read-only and answer lookups immediately; the pages
+ * are shared between processes mapping the same file.
+ *
+ * Entry layout at entriesOffset + index * entryStride(numActions):
+ *   InfoSetKey key; uint64 visitCount; double probs[numActions];
+ */
+namespace strategy_file {
+
+/// File magic ("AOFSTRAT", not NUL-terminated)
+constexpr char MAGIC[8] = {'A', 'O', 'F', 'S', 'T', 'R', 'A', 'T'};
+
+/// Current format version (version 1 was the length-prefixed text-key format)
+constexpr std::uint32_t VERSION = 2;
+
+/// Fixed-size file header (64 bytes)
+struct Header {
+    char magic[8];                  ///< Must equal MAGIC
+    std::uint32_t version;          ///< Must equal VERSION
+    std::uint32_t numActions;       ///< Probabilities per strategy entry
+    std::uint64_t entryCount;       ///< Number of stored strategies
+    std::uint64_t slotCount;        ///< Index slots (power of two)
+    std::uint64_t indexOffset;      ///< Byte offset of the IndexSlot array
+    std::uint64_t entriesOffset;    ///< Byte offset of the entry array
+    std::uint64_t analyticsOffset;  ///< Byte offset of the analytics index (0 = absent)
+    std::uint64_t reserved;         ///< Zero; room for future fields
+};
+static_assert(sizeof(Header) == 64, "Header must stay 64 bytes");
+
+/// The optional analytics index at analyticsOffset holds two arrays of
+/// entryCount uint64 entry indices each, back to back:
+///  - by descending visit count (ties broken by ascending key), so a
+///    top-K-by-visits query is a prefix read;
+///  - by (position, hole-card bucket, pot, key) ascending, extracted
+///    from the packed keys, so position and position+bucket filters are
+///    contiguous ranges found by binary search.
+/// The field was reserved (zero) before the index existed, so files
+/// written by older builds simply report the index as absent.
+constexpr std::size_t analyticsSize(std::uint64_t entryCount) noexcept {
+    return 2 * entryCount * sizeof(std::uint64_t);
+}
+
+/// One hash index slot; entryPlusOne is 0 for empty slots
+struct IndexSlot {
+    InfoSetKey key;
+    std::uint64_t entryPlusOne;
+};
+static_assert(sizeof(IndexSlot) == 16, "IndexSlot must stay 16 bytes");
+
+/// Fixed-size prefix of each entry, followed by numActions doubles
+struct EntryHeader {
+    InfoSetKey key;
+    std::uint64_t visitCount;
+};
+static_assert(sizeof(EntryHeader) == 16, "EntryHeader must stay 16 bytes");
+
+/// Byte stride of one entry (header plus probabilities)
+constexpr std::size_t entryStride(std::uint32_t numActions) noexcept {
+    return sizeof(EntryHeader) + numActions * sizeof(double);
+}
+
+/// File magic of regret delta files exchanged between distributed
+/// workers ("AOFREGRT", not NUL-terminated). Delta files reuse Header
+/// with slotCount and indexOffset zero (they are read sequentially, not
+/// indexed); each entry is an EntryHeader whose visitCount holds the
+/// visit delta, followed by numActions regret sum deltas and numActions
+/// strategy sum deltas.
+constexpr char REGRET_MAGIC[8] = {'A', 'O', 'F', 'R', 'E', 'G', 'R', 'T'};
+
+/// Current regret delta format version
+constexpr std::uint32_t REGRET_VERSION = 1;
+
+/// Byte stride of one regret delta entry
+constexpr std::size_t regretEntryStride(std::uint32_t numActions) noexcept {
+    return sizeof(EntryHeader) + 2 * numActions * sizeof(double);
+}
+
+/// File magic of lossless training checkpoints ("AOFCHKPT", not
+/// NUL-terminated). Checkpoints reuse Header with slotCount and
+/// indexOffset zero (they are read sequentially, not indexed);
+/// entriesOffset points past the ResumeState block and its trailing
+/// variable-length fields. Each entry is an EntryHeader whose visitCount
+/// holds the node's exact visit count, followed by numActions regret
+/// sums and numActions strategy sums (regretEntryStride).
+constexpr char CHECKPOINT_MAGIC[8] = {'A', 'O', 'F', 'C', 'H', 'K', 'P', 'T'};
+
+/// Current checkpoint format version
+constexpr std::uint32_t CHECKPOINT_VERSION = 1;
+
+/// Fixed-size trainer state written directly after the Header. It is
+/// followed by numPlayers accumulated exact utilities (doubles) and
+/// samplingRngBytes of serialized sampling RNG text, then the entries.
+struct ResumeState {
+    std::uint64_t completedIterations; ///< Iterations finished before the save
+    std::uint64_t masterSeed;          ///< Seed of the deal PRNG stream
+    std::uint32_t numPlayers;          ///< Utility doubles following this block
+    std::uint32_t samplingRngBytes;    ///< Serialized sampling RNG text length
+};
+static_assert(sizeof(ResumeState) == 24, "ResumeState must stay 24 bytes");
+
+/**
+ * @brief Hash a packed key for index placement (splitmix64 finalizer)
+ *
+ * Part of the file format: writer and reader must agree on it.
+ */
+constexpr std::uint64_t hashKey(InfoSetKey key) noexcept {
+    std::uint64_t h = key;
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h;
+}
+
+} // namespace strategy_file
+
+} // namespace mccfr
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+
+namespace mccfr {
+
+/**
+ * @brief Batched regret-matching and averaging kernels
+ *
+ * Per-node strategy math is a handful of scalar operations, so exporting
+ * or analyzing a multi-million-node map spends most of its time in loop
+ * and call overhead rather than arithmetic. These kernels take the same
+ * computations across many nodes at once: callers gather node sums into
+ * a dense row-major matrix (count rows of numActions doubles), run one
+ * kernel over the whole batch, and read the normalized rows back.
+ *
+ * When compiled with AVX2 (-mavx2 or -march=native) the two-action case
+ * — every AoF decision node — processes two nodes per 256-bit vector;
+ * otherwise a portable scalar implementation with the identical results
+ * is used.
+ */
+namespace kernels {
+
+/**
+ * @brief Regret-matching normalization across many nodes
+ *
+ * For each row: clamp entries to non-negative and divide by the row sum;
+ * rows with no positive entry become the uniform distribution. Matches
+ * Node::getStrategy's normalization exactly.
+ *
+ * @param rows Dense row-major regret sums, normalized in place
+ * @param count Number of rows (nodes)
+ * @param numActions Entries per row
+ */
+void regretMatchRows(double* rows, std::size_t count, int numActions);
+
+/**
+ * @brief Average-strategy normalization across many nodes
+ *
+ * For each row: divide by the row sum; rows summing to zero become the
+ * uniform distribution. Matches Node::getAverageStrategy exactly.
+ *
+ * @param rows Dense row-major strategy sums, normalized in place
+ * @param count Number of rows (nodes)
+ * @param numActions Entries per row
+ */
+void averageStrategyRows(double* rows, std::size_t count, int numActions);
+
+} // namespace kernels
+
+} // namespace mccfr
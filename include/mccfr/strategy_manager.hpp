@@ -1,6 +1,8 @@
 #pragma once
 
 #include "node.hpp"
+#include "flat_node_map.hpp"
+#include "strategy_file_format.hpp"
 #include <unordered_map>
 #include <string>
 #include <vector>
@@ -20,6 +22,16 @@ public:
      */
     void loadFromNodeMap(const std::unordered_map<std::string, Node>& nodeMap);
 
+    /**
+     * @brief Load strategies from a trained flat node map
+     *
+     * Average strategies for the whole map are normalized in one batched
+     * kernel pass; keys are decoded to information set strings.
+     *
+     * @param nodeMap Packed-key node map
+     */
+    void loadFromNodeMap(const FlatNodeMap& nodeMap);
+
     /**
      * @brief Save strategies to file in human-readable format
      * @param filename Output filename
@@ -29,7 +41,16 @@ public:
     bool saveToFile(const std::string& filename, bool includeVisitCounts = true) const;
 
     /**
-     * @brief Save strategies in binary format for faster loading
+     * @brief Save strategies in the memory-mappable binary format
+     *
+     * Writes the version-2 layout from strategy_file_format.hpp: header,
+     * embedded hash index, then fixed-stride entries keyed by packed
+     * information set keys. The result can be consumed either by
+     * loadFromBinary or zero-copy through MappedStrategyFile. Strategies
+     * whose information set string does not parse into a packed key (or
+     * whose action count differs from the rest) are skipped with a
+     * warning.
+     *
      * @param filename Output filename
      * @return True if successful
      */
@@ -135,17 +156,21 @@ private:
                           std::uint64_t& visitCount) const;
 
     /**
-     * @brief Write binary header information
+     * @brief Write the binary file header
      * @param file Output file stream
+     * @param header Populated header to write
      */
-    void writeBinaryHeader(std::ofstream& file) const;
+    void writeBinaryHeader(std::ofstream& file,
+                          const strategy_file::Header& header) const;
 
     /**
-     * @brief Read and validate binary header
+     * @brief Read and validate the binary file header
      * @param file Input file stream
+     * @param header Receives the header on success
      * @return True if header is valid
      */
-    bool readBinaryHeader(std::ifstream& file) const;
+    bool readBinaryHeader(std::ifstream& file,
+                         strategy_file::Header& header) const;
 };
 
 } // namespace mccfr
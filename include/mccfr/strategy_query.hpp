@@ -0,0 +1,113 @@
+#pragma once
+
+#include "info_set_key.hpp"
+#include "strategy_manager.hpp"
+#include "../aof/card.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace mccfr {
+
+/**
+ * @brief Structured description of a live decision point
+ *
+ * The inputs a bot has at hand when it must act: its seat, the observed
+ * fold/all-in pattern, its two hole cards and the pot. The table applies
+ * the same visibility rule and bucketing as training, so no information
+ * set string ever needs to be formatted.
+ */
+struct StrategyQuery {
+    int player = 0;                ///< Acting player position (0-3)
+    std::uint8_t foldedMask = 0;   ///< Bit p set = player p has folded
+    std::uint8_t allInMask = 0;    ///< Bit p set = player p is all-in
+    aof::Card holeCard1;           ///< First hole card
+    aof::Card holeCard2;           ///< Second hole card
+    double pot = 0.0;              ///< Current pot size in chips
+};
+
+/**
+ * @brief Read-only perfect-hashed table for low-latency strategy queries
+ *
+ * Built once at load from trained output, then immutable: lookups are a
+ * key composition, one displacement fetch and one slot probe — no
+ * probe chains, no allocation, no locks — so latency is flat and const
+ * queries are safe from any number of concurrent reader threads.
+ *
+ * The perfect hash uses hash-and-displace: keys are grouped into
+ * buckets by a first-level hash and each bucket gets a displacement
+ * seed chosen at build time so its keys land in distinct free slots.
+ */
+class StrategyQueryTable {
+public:
+    /**
+     * @brief Build the table from a loaded strategy manager
+     *
+     * Strategies whose information set string does not parse into a
+     * packed key are skipped, mirroring saveToBinary.
+     *
+     * @param manager Manager holding trained strategies
+     */
+    void build(const StrategyManager& manager);
+
+    /**
+     * @brief Build the table straight from a binary strategy file
+     * @param filename File written by StrategyManager::saveToBinary
+     * @return True if the file was read and the table built
+     */
+    bool loadFromBinary(const std::string& filename);
+
+    /**
+     * @brief Resolve a structured query into an action distribution
+     * @param query Decision point description
+     * @param strategy Caller buffer for numActions() probabilities
+     * @return Number of probabilities written, 0 if the point is unknown
+     */
+    int lookup(const StrategyQuery& query, double* strategy) const noexcept;
+
+    /**
+     * @brief Resolve a pre-encoded key into an action distribution
+     * @param key Packed information set key
+     * @param strategy Caller buffer for numActions() probabilities
+     * @return Number of probabilities written, 0 if the key is unknown
+     */
+    int lookup(InfoSetKey key, double* strategy) const noexcept;
+
+    /**
+     * @brief Get number of stored strategies
+     */
+    std::size_t size() const noexcept { return entryCount_; }
+
+    /**
+     * @brief Check whether any strategies are loaded
+     */
+    bool empty() const noexcept { return entryCount_ == 0; }
+
+    /**
+     * @brief Get number of action probabilities per strategy
+     */
+    int numActions() const noexcept { return numActions_; }
+
+private:
+    /// Slot key value marking an empty slot (never a valid encoded key)
+    static constexpr InfoSetKey EMPTY_KEY = ~InfoSetKey{0};
+
+    std::size_t entryCount_ = 0;
+    int numActions_ = 0;
+    std::uint64_t slotMask_ = 0;    ///< slotCount - 1 (power of two)
+    std::uint64_t bucketMask_ = 0;  ///< bucketCount - 1 (power of two)
+
+    std::vector<InfoSetKey> slotKeys_;          ///< Key per slot (EMPTY_KEY = free)
+    std::vector<double> slotStrategies_;        ///< numActions_ doubles per slot
+    std::vector<std::uint32_t> displacements_;  ///< Per-bucket displacement seed
+
+    /**
+     * @brief Build the perfect hash over gathered (key, strategy) rows
+     * @param keys Packed keys, one per entry
+     * @param rows Dense row-major strategies, numActions per entry
+     */
+    void buildTable(const std::vector<InfoSetKey>& keys,
+                    const std::vector<double>& rows);
+};
+
+} // namespace mccfr
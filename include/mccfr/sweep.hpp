@@ -0,0 +1,118 @@
+#pragma once
+
+#include "trainer.hpp"
+#include "../aof/game.hpp"
+#include "../aof/equity_engine.hpp"
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mccfr {
+
+/**
+ * @brief One game configuration inside a sweep
+ *
+ * Parsed from a sweep file: one configuration per line,
+ *
+ *   <name> <smallBlind> <bigBlind> <iterations> [stack0 .. stack3]
+ *
+ * with '#' comments and blank lines ignored. Stacks are in big blinds
+ * and optional (the game's default applies when omitted).
+ */
+struct SweepEntry {
+    std::string name;            ///< Configuration name (suffixes the output prefix)
+    double smallBlind = 0.4;     ///< Small blind amount
+    double bigBlind = 1.0;       ///< Big blind amount
+    int iterations = 1000000;    ///< Training iterations for this configuration
+    std::vector<double> stacksBB;  ///< Per-position stacks in BB ("" = default)
+};
+
+/**
+ * @brief Outcome of one sweep configuration
+ */
+struct SweepResult {
+    SweepEntry entry;                      ///< The configuration that ran
+    bool succeeded = false;                ///< False if training threw
+    std::string error;                     ///< Exception text when it did
+    std::size_t informationSets = 0;       ///< Information sets learned
+    std::chrono::milliseconds trainTime{0};  ///< Wall time spent training
+    aof::PlayerUtilities finalUtilities;   ///< Final average utilities
+    double exploitability = -1.0;          ///< Chips/hand (-1 = not evaluated)
+};
+
+/**
+ * @brief Scheduler running many training configurations in one process
+ *
+ * Production sweeps train dozens of blind/stack configurations; instead
+ * of launching one process per configuration and oversubscribing the
+ * machine by hand, the runner executes independent Trainer instances
+ * across a fixed pool of worker threads, one configuration per worker at
+ * a time. Read-only resources are shared: the card and bucket tables are
+ * process-wide already, and a single equity engine (thread-safe, lazily
+ * populated) can be attached to every game so no configuration reloads
+ * or re-estimates tables another one already paid for.
+ *
+ * Each configuration writes its strategy output under
+ * <outputPrefix>_<name>; the runner writes a per-configuration summary
+ * to <outputPrefix>_sweep_summary.csv when the sweep finishes.
+ */
+class SweepRunner {
+public:
+    /**
+     * @brief Sweep-wide options shared by every configuration
+     */
+    struct Options {
+        int numWorkers = 1;                ///< Configurations trained concurrently
+        std::string outputPrefix = "sweep";  ///< Prefix for outputs and the summary
+        std::uint64_t rngSeed = 0;         ///< Base seed; entry k trains with seed + k (0 = random)
+        SamplingScheme samplingScheme = SamplingScheme::EXTERNAL;  ///< Traversal variant
+        UpdateRule updateRule = UpdateRule::VANILLA;  ///< Regret update variant
+        int evaluationDeals = 0;           ///< Post-training exploitability deals (0 = skip)
+        bool enableProgressOutput = true;  ///< Per-configuration start/finish lines
+        /// Equity engine shared read-only by every configuration's game
+        /// (nullptr = sampled-board terminal evaluation)
+        std::shared_ptr<const aof::EquityEngine> equityEngine;
+    };
+
+    /**
+     * @brief Parse a sweep configuration file
+     * @param filename Input filename
+     * @return Parsed entries in file order
+     * @throws std::runtime_error on unreadable files or malformed lines
+     */
+    static std::vector<SweepEntry> loadSweepFile(const std::string& filename);
+
+    /**
+     * @brief Train every configuration and write the summary
+     *
+     * Blocks until all configurations finish. A configuration that
+     * throws is recorded as failed and does not stop the others.
+     *
+     * @param entries Configurations to train
+     * @param options Sweep-wide options
+     * @return One result per entry, in entry order
+     */
+    std::vector<SweepResult> run(const std::vector<SweepEntry>& entries,
+                                 const Options& options) const;
+
+private:
+    /**
+     * @brief Train a single configuration on the calling worker thread
+     * @param entry Configuration to train
+     * @param entryIndex Position in the sweep (seeds and output naming)
+     * @param options Sweep-wide options
+     */
+    SweepResult runEntry(const SweepEntry& entry, std::size_t entryIndex,
+                         const Options& options) const;
+
+    /**
+     * @brief Write the per-configuration summary CSV
+     * @param results Finished results in entry order
+     * @param options Sweep-wide options (output prefix)
+     */
+    void writeSummary(const std::vector<SweepResult>& results,
+                      const Options& options) const;
+};
+
+} // namespace mccfr
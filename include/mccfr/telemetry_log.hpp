@@ -0,0 +1,167 @@
+/**
+ * @file telemetry_log.hpp
+ * @brief Durable append-only binary log of training telemetry with rotation
+ */
+
+#pragma once
+
+#include "spsc_ring_buffer.hpp"
+#include "../aof/game_config.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+namespace mccfr {
+namespace telemetry_log {
+
+/// File magic identifying a telemetry log segment ("AOFTELOG")
+constexpr char MAGIC[8] = {'A', 'O', 'F', 'T', 'E', 'L', 'O', 'G'};
+
+/// Bumped whenever the header or record layout changes
+constexpr std::uint32_t VERSION = 1;
+
+/**
+ * @brief Header at offset 0 of every telemetry log segment
+ *
+ * Followed by a plain sequence of fixed-size TelemetryRecord entries
+ * until end of file; record count is implied by the file size, so an
+ * append never rewrites the header and a crash at worst truncates the
+ * final record (which the reader drops).
+ */
+struct FileHeader {
+    char magic[8];                        ///< MAGIC
+    std::uint32_t version;                ///< VERSION
+    std::uint32_t recordSize;             ///< sizeof(TelemetryRecord)
+    std::uint8_t reserved[48];            ///< Zero; reserved for later use
+};
+
+static_assert(sizeof(FileHeader) == 64, "log header layout is part of the file format");
+
+/**
+ * @brief One fixed-size telemetry record
+ *
+ * Everything the removed CSV log carried plus the run-rate counters, in
+ * an explicitly sized layout so external tools can decode segments with
+ * a single struct format.
+ */
+struct TelemetryRecord {
+    std::int64_t iteration = 0;           ///< Training iteration the record describes
+    std::int64_t elapsedMs = 0;           ///< Wall time since train() started
+    std::uint64_t nodeCount = 0;          ///< Information sets in the node map
+    double iterationsPerSecond = 0.0;     ///< Run rate over the elapsed time
+    double meanAbsoluteError = 0.0;       ///< Mean absolute utility error
+    std::array<double, aof::GameConfig::NUM_PLAYERS> playerUtilities{};  ///< Average utilities
+    std::uint64_t reserved = 0;           ///< Zero; reserved for later use
+};
+
+static_assert(sizeof(TelemetryRecord) == 80,
+              "record layout is part of the file format");
+static_assert(std::is_trivially_copyable<TelemetryRecord>::value,
+              "TelemetryRecord must stay POD for the ring buffer and file writes");
+
+/**
+ * @brief Buffered background writer of telemetry log segments
+ *
+ * The training thread pays one struct copy per append: records travel
+ * through the same lock-free ring buffer the realtime visualizer uses,
+ * and a background thread batches them into buffered writes with a
+ * periodic fsync, so a crash loses at most the last sync interval. When
+ * a segment outgrows the size limit it is rotated shift-style
+ * (<file> -> <file>.1 -> <file>.2 ...) and a fresh segment is started,
+ * bounding the disk footprint of arbitrarily long runs.
+ *
+ * Exactly one thread may call append(); open() and close() belong to
+ * that same thread.
+ */
+class TelemetryLogWriter {
+public:
+    /// Rotation and durability knobs for a writer
+    struct Options {
+        std::size_t maxFileBytes = 64ull << 20;  ///< Rotate segments past this size
+        int rotatedFilesToKeep = 3;              ///< <file>.1 .. <file>.N kept on disk
+        int fsyncIntervalMs = 1000;              ///< Max age of unsynced records
+    };
+
+    TelemetryLogWriter() = default;
+    ~TelemetryLogWriter();
+
+    TelemetryLogWriter(const TelemetryLogWriter&) = delete;
+    TelemetryLogWriter& operator=(const TelemetryLogWriter&) = delete;
+
+    /**
+     * @brief Start logging to a fresh segment
+     *
+     * An existing log at the filename is rotated first, so restarting a
+     * run keeps the previous run's records instead of overwriting them.
+     *
+     * @param filename Segment filename; rotated segments get .1/.2/... suffixes
+     * @param options Rotation and durability settings
+     * @return true when the segment was created and the writer started
+     */
+    bool open(const std::string& filename, const Options& options);
+
+    /**
+     * @brief Queue one record: a struct copy, never a syscall
+     *
+     * Wait-free for the caller; if the background writer falls more than
+     * the queue capacity behind, the oldest queued records are dropped
+     * rather than ever stalling training. Silently ignored when the
+     * writer is not open so call sites need no guard.
+     */
+    void append(const TelemetryRecord& record) noexcept;
+
+    /// @brief Whether a segment is open and the writer thread is running
+    bool isOpen() const { return open_.load(std::memory_order_relaxed); }
+
+    /// @brief Records written to disk so far (all segments)
+    std::uint64_t recordsWritten() const {
+        return recordsWritten_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Drain the queue, sync the segment and stop the writer thread
+     */
+    void close();
+
+private:
+    /// Capacity of the producer/consumer hand-off buffer (power of two)
+    static constexpr std::size_t QUEUE_CAPACITY = 4096;
+
+    Options options_;
+    std::string filename_;
+
+    // The descriptor belongs to the writer thread once it starts (it is
+    // swapped during rotation); the producer side only reads the flag
+    int fd_ = -1;
+    std::size_t segmentBytes_ = 0;
+
+    std::atomic<bool> open_{false};
+    std::atomic<bool> shouldStop_{false};
+    std::atomic<std::uint64_t> recordsWritten_{0};
+    std::thread writerThread_;
+    SpscRingBuffer<TelemetryRecord, QUEUE_CAPACITY> queue_;
+
+    bool openSegment();
+    void rotateSegments();
+    void writerLoop();
+};
+
+/**
+ * @brief Export one telemetry log segment to CSV
+ *
+ * Produces a header row plus one row per intact record
+ * (iteration, elapsed_ms, nodes, iter_per_sec, mae, utility_0..3) for
+ * visualizer.py and the plotting scripts; a trailing partial record from
+ * an interrupted run is skipped. Rotated segments convert one at a time.
+ *
+ * @param logFile Segment written by a TelemetryLogWriter
+ * @param csvFile Output CSV filename
+ * @return true when the segment was valid and the CSV was written
+ */
+bool exportCsv(const std::string& logFile, const std::string& csvFile);
+
+} // namespace telemetry_log
+} // namespace mccfr
@@ -1,10 +1,16 @@
 #pragma once
 
 #include "node.hpp"
+#include "flat_node_map.hpp"
+#include "sharded_node_map.hpp"
 #include "../aof/game.hpp"
+#include "../aof/profiling.hpp"
 #include "../aof/game_state.hpp"
 #include "realtime_visualizer.hpp"
+#include "best_response.hpp"
+#include "../aof/game_config.hpp"
 #include <unordered_map>
+#include <array>
 #include <memory>
 #include <string>
 #include <functional>
@@ -12,6 +18,10 @@
 
 namespace mccfr {
 
+/// Per-seat reach probabilities kept as a stack-local fixed array so the
+/// recursion never copies a heap-allocated vector per visited node
+using ReachProbs = std::array<double, aof::GameConfig::NUM_PLAYERS>;
+
 /**
  * @brief Progress callback function type
  * @param iteration Current iteration number
@@ -21,6 +31,19 @@ namespace mccfr {
 using ProgressCallback = std::function<void(int iteration, int totalIterations, 
                                           std::chrono::milliseconds elapsedTime)>;
 
+/**
+ * @brief MCCFR traversal schemes
+ */
+enum class SamplingScheme {
+    /// Expand every trained-player action, sample opponents and chance.
+    /// Lowest-variance updates; the historical behavior of this trainer.
+    EXTERNAL,
+    /// Sample a single trajectory end to end with exploration at the
+    /// trained player's nodes and importance-weighted regret updates.
+    /// Much cheaper per iteration at the cost of higher variance.
+    OUTCOME
+};
+
 /**
  * @brief Configuration for MCCFR training
  */
@@ -29,16 +52,85 @@ struct TrainingConfig {
     int progressUpdateInterval = 10000;    ///< How often to report progress
     bool enableProgressOutput = true;      ///< Whether to print progress
     std::string outputPrefix = "strategy"; ///< Prefix for output files
+
+    // Traversal options
+    SamplingScheme samplingScheme = SamplingScheme::EXTERNAL;  ///< Per-iteration traversal variant
+    /// Deals processed per batch: states for batchSize iterations are
+    /// dealt up front and their traversals and terminal evaluations run
+    /// stage by stage, keeping the deck pipeline, node-map lines and
+    /// evaluator tables hot across the batch instead of cold-starting
+    /// every iteration. Periodic work (checkpoints, delta sync,
+    /// exploitability) lands on batch boundaries, so resuming a batched
+    /// checkpoint replays exactly when the same batch size is used.
+    int batchSize = 1;
+    double explorationEpsilon = 0.6;       ///< Exploration mix at trained-player nodes (OUTCOME only)
+    std::uint64_t rngSeed = 0;             ///< Master seed for deals and sampling (0 = random)
+    UpdateRule updateRule = UpdateRule::VANILLA;  ///< Regret/strategy update variant
+    double dcfrAlpha = 1.5;                ///< Positive-regret discount exponent (DISCOUNTED)
+    double dcfrBeta = 0.0;                 ///< Negative-regret discount exponent (DISCOUNTED)
+    double dcfrGamma = 2.0;                ///< Strategy-sum discount exponent (DISCOUNTED)
+
+    // Regret-based pruning options (EXTERNAL sampling only; outcome
+    // sampling already descends a single sampled action per node, so
+    // there is no branch to skip). Actions whose cumulative regret has
+    // sunk below the threshold are not traversed and receive no regret
+    // update; re-exploration iterations traverse everything so a pruned
+    // action can recover if the surrounding strategies shift.
+    bool enablePruning = false;            ///< Skip trained-player branches with hopeless regret
+    double pruningThreshold = -300.0;      ///< Cumulative regret below which a branch is skipped
+    int pruningWarmupIterations = 10000;   ///< Full traversals before pruning may start
+    int pruningRestoreInterval = 100;      ///< Every Nth iteration re-explores pruned branches
+
+    // Memory budget options (single-threaded training only, which covers
+    // sweep workers — each sweep configuration trains on one thread).
+    // When the node map outgrows the budget, the lowest-visit half of the
+    // nodes is appended to <outputPrefix>_spill.bin in the regret-delta
+    // format and dropped from RAM; a respawned node restarts from zero
+    // and the spilled sums are merged back (additively, hence exactly)
+    // before the final save. Under CFR+ or DCFR the spilled sums skip
+    // the per-touch discounting while on disk, so budgeted runs under
+    // those rules trade a small averaging bias for the memory ceiling.
+    // Budgeted runs cannot warm start: a spilled node recreated by the
+    // training loop would be seeded a second time while its first
+    // seeding still sits in the spill file, so the final merge would
+    // carry the prior twice. The CLI exposes this in whole megabytes
+    // via --memory-budget.
+    std::size_t memoryBudgetBytes = 0;     ///< Node-map budget in bytes (0 = unlimited)
+
+    // Parallel training options
+    int numThreads = 1;                    ///< Worker threads running iterations (1 = single-threaded)
     
+    // Checkpointing options (each checkpoint also refreshes the lossless
+    // <outputPrefix>_resume.ckpt file used by loadCheckpoint)
+    int checkpointInterval = 0;            ///< Save a checkpoint every N iterations (0 = disabled)
+    int checkpointsToKeep = 3;             ///< Rotating checkpoint files kept on disk
+
+    // Exploitability evaluation options
+    int exploitabilityInterval = 0;        ///< Evaluate exploitability every N iterations (0 = disabled)
+    int exploitabilityDeals = 20000;       ///< Hole-card deals sampled per evaluation
+    double exploitabilityThreshold = 0.0;  ///< Stop early below this, in chips/hand (0 = never)
+
+    // Distributed training options (workers are independent processes
+    // sharing syncDirectory; each worker runs single-threaded)
+    std::string syncDirectory;             ///< Shared delta directory ("" = disabled)
+    int syncWorkerId = 0;                  ///< Identifier unique among workers
+    int syncInterval = 100000;             ///< Iterations between delta exchanges
+
     // Utility tracking options
     bool enableUtilityTracking = true;     ///< Whether to track and display utilities
     int utilityUpdateInterval = 10000;     ///< How often to report utility statistics
     bool showUtilityVariance = true;       ///< Whether to calculate and show variance
     
-    // Data logging options
-    bool enableDataLogging = true;         ///< Whether to log training data
-    std::string dataLogFile = "training_data.csv";  ///< Data log filename
-    int dataLogInterval = 10;              ///< How often to log data points
+    // Durable telemetry logging (single-threaded training loop only):
+    // fixed-size binary records streamed through a buffered background
+    // writer with periodic fsync and size-based rotation, so long runs
+    // keep a convergence record that survives the process. Export with
+    // telemetry_log::exportCsv or the CLI's --telemetry-to-csv.
+    bool enableDataLogging = false;        ///< Whether to stream telemetry records to disk
+    std::string dataLogFile = "training_telemetry.bin";  ///< Telemetry log filename
+    int dataLogInterval = 10;              ///< Iterations between records
+    std::size_t dataLogMaxBytes = 64ull << 20;  ///< Segment size that triggers rotation
+    int dataLogFilesToKeep = 3;            ///< Rotated segments kept on disk
     bool enableRealtimeVisualization = false;  ///< Enable real-time visualization mode
     
     // Direct real-time visualization (no intermediate files)
@@ -78,7 +170,8 @@ public:
 
     /**
      * @brief Get all learned strategies
-     * @return Map from information sets to average strategies
+     * @return Map from information set strings (decoded from the packed
+     *         keys) to average strategies
      */
     std::unordered_map<std::string, std::vector<double>> getAllStrategies() const;
 
@@ -96,6 +189,57 @@ public:
      */
     bool loadStrategies(const std::string& filename);
 
+    /**
+     * @brief Save a lossless training checkpoint
+     *
+     * Unlike saveStrategies, which keeps only the normalized averages,
+     * this serializes every node's exact regret sums, strategy sums and
+     * visit counts plus the iteration count, accumulated utilities and
+     * RNG state. Call from the thread that ran train() so the sampling
+     * RNG position is the one the run actually holds.
+     *
+     * @param filename Output filename (written atomically via a rename)
+     * @return True if the file was written
+     */
+    bool saveCheckpoint(const std::string& filename) const;
+
+    /**
+     * @brief Load a checkpoint written by saveCheckpoint
+     *
+     * Restores the node map exactly and arms the next train() call to
+     * continue from the recorded iteration: the single-threaded path
+     * replays bit-for-bit what an uninterrupted run would have done.
+     * The parallel path continues from the same exact sums but cannot
+     * reproduce the original update interleaving. config.iterations is
+     * the total for the whole run, so resuming a 1M-iteration run killed
+     * at 400k trains the remaining 600k.
+     *
+     * @param filename Input filename
+     * @return True if successful
+     */
+    bool loadCheckpoint(const std::string& filename);
+
+    /**
+     * @brief Seed future nodes from a related configuration's strategies
+     *
+     * Warm start for chained configurations (e.g. stepping through stack
+     * sizes): loads a strategy file (text or binary) saved by a prior
+     * run and seeds every node the next train() call creates with the
+     * prior average strategy, weighted by priorWeight pseudo-visits of
+     * strategy-sum mass. Information sets are matched on the structured
+     * key fields that survive a configuration change — position, status
+     * pattern and hole-card bucket — with the pot ignored; a prior that
+     * covers several pots contributes its visit-weighted average.
+     * Regret sums start at zero, so regret matching re-learns freely
+     * while the average strategy starts near the prior instead of
+     * uniform. Unmatched information sets train cold as before.
+     *
+     * @param filename Strategy file from the prior configuration
+     * @param priorWeight Strategy-sum mass given to the prior (> 0)
+     * @return True if the file was loaded and the prior installed
+     */
+    bool warmStart(const std::string& filename, double priorWeight);
+
     /**
      * @brief Reset all learned strategies
      */
@@ -109,26 +253,249 @@ public:
         std::chrono::milliseconds totalTime{0};
         std::size_t informationSetsCount = 0;
         aof::PlayerUtilities finalUtilities;
+        std::size_t peakNodeMapBytes = 0;   ///< Largest node-map footprint seen
+        std::size_t spilledNodes = 0;       ///< Nodes evicted by the memory budget
+        /// Aggregated hot-path instrumentation; empty unless the binary
+        /// was built with -DAOF_PROFILE (see aof/profiling.hpp)
+        std::vector<aof::profiling::Entry> profile;
     };
     
     const TrainingStats& getStats() const noexcept { return stats_; }
 
+    /**
+     * @brief Measure exploitability of the current average strategies
+     *
+     * Runs the best-response engine against a snapshot of the learned
+     * profile; see BestResponseEvaluator for the methodology.
+     *
+     * @param numDeals Hole-card deals to sample
+     * @param numThreads Worker threads to spread the deals over
+     * @param seed Seed for the deal sequence
+     * @return Per-player best-response and profile values
+     */
+    ExploitabilityResult computeExploitability(int numDeals = 20000,
+                                               int numThreads = 1,
+                                               std::uint64_t seed = 1) const;
+
 private:
     const aof::Game& game_;
-    std::unordered_map<std::string, Node> nodeMap_;
+    FlatNodeMap nodeMap_;
     TrainingStats stats_;
     std::unique_ptr<RealtimeVisualizer> visualizer_;
 
+    // Resume state: written by train() as it runs and by loadCheckpoint,
+    // read by saveCheckpoint and by the next train() when a resume is
+    // pending. The deal PRNG is not stored directly; it is replayed from
+    // masterSeed_ (one draw per iteration), which is exact and cheap.
+    std::uint64_t masterSeed_ = 0;           ///< Deal PRNG seed of the current run
+    aof::PlayerUtilities cumulativeUtilities_; ///< Exact-utility sums across iterations
+    std::string resumeSamplingRng_;          ///< Sampling RNG state from the checkpoint
+    int resumeIteration_ = 0;                ///< Iterations completed before the resume
+    bool resumePending_ = false;             ///< Next train() continues a loaded checkpoint
+    std::string spillFile_;                  ///< Active spill file ("" = none this run)
+
+    // Warm-start prior: average strategies from a related configuration,
+    // keyed by pot-stripped information set keys (keyStructure). Fresh
+    // nodes are seeded through the node maps' creation hooks.
+    std::unordered_map<InfoSetKey, std::array<double, Node::MAX_ACTIONS>>
+        warmStartPrior_;
+    double warmStartWeight_ = 0.0;           ///< Strategy-sum mass per seeded node
+
     /**
      * @brief Core MCCFR recursive function
-     * @param state Current game state
+     *
+     * Walks the tree on a single state object: each action is applied,
+     * recursed into, then reversed with GameState::undoAction, so the
+     * recursion never clones the state. Reach probabilities are modified
+     * in place and restored on the way back up.
+     *
+     * @param state Current game state (restored on return)
      * @param player Player being trained (0-3)
      * @param reachProb Reach probabilities for all players
+     * @param policy Update rule and current iteration
      * @return Expected utility for the training player
      */
-    double mccfr(std::unique_ptr<aof::GameState> state, 
-                int player, 
-                std::vector<double>& reachProb);
+    double mccfr(aof::GameState& state,
+                int player,
+                ReachProbs& reachProb,
+                const UpdatePolicy& policy);
+
+    /**
+     * @brief Outcome-sampling MCCFR recursion (single sampled trajectory)
+     *
+     * Samples one action everywhere: with an epsilon-greedy mix at the
+     * trained player's nodes (so every action keeps positive sampling
+     * probability) and with the current strategy at opponent nodes.
+     * Terminal utility is importance-corrected by the trajectory's
+     * sampling probability; regrets for unsampled actions use the
+     * standard zero-utility estimate, so the updates stay unbiased.
+     *
+     * @param state Current game state (restored on return)
+     * @param player Player being trained (0-3)
+     * @param reachPlayer Trained player's reach probability
+     * @param reachOthers Combined reach probability of the opponents
+     * @param sampleProb Probability of having sampled this trajectory
+     * @param explorationEpsilon Exploration mix at trained-player nodes
+     * @param policy Update rule and current iteration
+     * @param tailProb Receives the strategy probability of the sampled
+     *        trajectory from this node to the terminal
+     * @return Importance-corrected utility estimate for the trained player
+     */
+    double mccfrOutcome(aof::GameState& state,
+                       int player,
+                       double reachPlayer,
+                       double reachOthers,
+                       double sampleProb,
+                       double explorationEpsilon,
+                       const UpdatePolicy& policy,
+                       double& tailProb);
+
+    /**
+     * @brief Run the iteration loop across multiple worker threads
+     *
+     * Workers run independent MCCFR iterations concurrently against a
+     * sharded node map; results are merged into nodeMap_ before return.
+     * Progress output is reduced compared to the single-threaded path,
+     * which remains available (numThreads = 1) for reproducible runs.
+     *
+     * @param config Training configuration (numThreads > 1)
+     * @return Final average utilities for each player
+     */
+    aof::PlayerUtilities trainParallel(const TrainingConfig& config);
+
+    /**
+     * @brief MCCFR recursion against a sharded node map (thread-safe)
+     *
+     * Identical traversal to mccfr(), but node access goes through
+     * per-shard locks. Locks are never held across recursive calls, so
+     * concurrent regret updates to the same node may interleave; this is
+     * the usual trade-off for lock-striped parallel MCCFR and does not
+     * affect convergence in expectation.
+     *
+     * @param nodes Shared node storage
+     * @param state Current game state (restored on return)
+     * @param player Player being trained (0-3)
+     * @param reachProb Reach probabilities for all players
+     * @param policy Update rule and current iteration
+     * @return Expected utility for the training player
+     */
+    double mccfrSharded(ShardedNodeMap& nodes,
+                       aof::GameState& state,
+                       int player,
+                       ReachProbs& reachProb,
+                       const UpdatePolicy& policy);
+
+    /**
+     * @brief Outcome-sampling recursion against a sharded node map
+     *
+     * Same traversal as mccfrOutcome with per-shard locking; locks are
+     * never held across recursive calls.
+     *
+     * @param nodes Shared node storage
+     * @param state Current game state (restored on return)
+     * @param player Player being trained (0-3)
+     * @param reachPlayer Trained player's reach probability
+     * @param reachOthers Combined reach probability of the opponents
+     * @param sampleProb Probability of having sampled this trajectory
+     * @param explorationEpsilon Exploration mix at trained-player nodes
+     * @param policy Update rule and current iteration
+     * @param tailProb Receives the strategy probability of the sampled
+     *        trajectory from this node to the terminal
+     * @return Importance-corrected utility estimate for the trained player
+     */
+    double mccfrOutcomeSharded(ShardedNodeMap& nodes,
+                              aof::GameState& state,
+                              int player,
+                              double reachPlayer,
+                              double reachOthers,
+                              double sampleProb,
+                              double explorationEpsilon,
+                              const UpdatePolicy& policy,
+                              double& tailProb);
+
+    /**
+     * @brief Write a node map to a strategy file
+     *
+     * Shared by saveStrategies and the checkpoint writer; safe to call
+     * from a background thread as long as `nodes` is not concurrently
+     * modified (checkpoints pass a snapshot copy).
+     *
+     * @param nodes Node map to serialize
+     * @param filename Output filename
+     * @param includeVisitCounts Whether to include visit count statistics
+     * @param totalIterations Iteration count recorded in the file header
+     */
+    void writeStrategies(const FlatNodeMap& nodes,
+                        const std::string& filename,
+                        bool includeVisitCounts,
+                        int totalIterations) const;
+
+    /**
+     * @brief Write a lossless checkpoint of a node map plus trainer state
+     *
+     * Shared by saveCheckpoint and the periodic checkpoint writers; safe
+     * to call from a background thread as long as `nodes` is not
+     * concurrently modified (checkpoints pass a snapshot copy). The file
+     * is written to a temporary name and renamed into place so a crash
+     * mid-write never corrupts an existing checkpoint.
+     *
+     * @param nodes Node map to serialize
+     * @param filename Output filename
+     * @param completedIterations Iterations finished before the save
+     * @param masterSeed Seed of the deal PRNG stream
+     * @param utilities Accumulated exact utilities per player
+     * @param samplingRngState Serialized sampling RNG ("" if unavailable)
+     * @return True if the file was written
+     */
+    bool writeCheckpoint(const FlatNodeMap& nodes,
+                        const std::string& filename,
+                        int completedIterations,
+                        std::uint64_t masterSeed,
+                        const aof::PlayerUtilities& utilities,
+                        const std::string& samplingRngState) const;
+
+    /**
+     * @brief Enforce TrainingConfig::memoryBudgetBytes on the node map
+     *
+     * No-op while the map fits. Over budget, spills the lowest-visit
+     * half of the nodes (their full sums, in the regret-delta format) to
+     * spillFile_ and rehashes the survivors into a smaller table. Warns
+     * if even a full spill cannot satisfy the budget.
+     *
+     * @param config Training configuration (budget, output prefix)
+     */
+    void enforceMemoryBudget(const TrainingConfig& config);
+
+    /**
+     * @brief Build the node-creation hook that applies warmStartPrior_
+     *
+     * Returns an empty function when no prior is loaded, so the node
+     * maps skip the hook entirely.
+     */
+    FlatNodeMap::NodeInitializer makeWarmStartInitializer() const;
+
+    /**
+     * @brief Merge every segment of a spill file back into the node map
+     *
+     * Spill segments are additive, so accumulating them into whatever
+     * the map now holds loses none of the regret and strategy weight
+     * this run earned; no spilled sum is dropped from the final save.
+     *
+     * @param filename Spill file written by enforceMemoryBudget
+     * @return True if every segment was read back
+     */
+    bool mergeSpillFile(const std::string& filename);
+
+    /**
+     * @brief Aggregate instrumentation into stats_ and dump a JSON profile
+     *
+     * Writes <outputPrefix>_profile.json and prints a short table when
+     * progress output is on. No-op in builds without -DAOF_PROFILE,
+     * where collect() returns nothing.
+     *
+     * @param config Training configuration (output prefix, verbosity)
+     */
+    void writeProfileReport(const TrainingConfig& config);
 
     /**
      * @brief Update progress display
@@ -37,11 +37,62 @@ int sampleAction(const std::vector<double>& strategy, std::mt19937& rng);
 
 /**
  * @brief Sample an action using thread-local RNG
- * @param strategy Probability distribution over actions  
+ * @param strategy Probability distribution over actions
  * @return Sampled action index
  */
 int sampleAction(const std::vector<double>& strategy);
 
+/**
+ * @brief Sample an action from a raw probability buffer
+ *
+ * Allocation-free variants for the traversal hot path, where strategies
+ * live in fixed-size stack buffers rather than vectors.
+ *
+ * @param strategy Pointer to numActions probabilities
+ * @param numActions Number of actions in the buffer
+ * @param rng Random number generator
+ * @return Sampled action index
+ */
+int sampleAction(const double* strategy, int numActions, std::mt19937& rng);
+
+/**
+ * @brief Sample an action from a raw probability buffer (thread-local RNG)
+ * @param strategy Pointer to numActions probabilities
+ * @param numActions Number of actions in the buffer
+ * @return Sampled action index
+ */
+int sampleAction(const double* strategy, int numActions);
+
+/**
+ * @brief Reseed the calling thread's sampling RNG
+ *
+ * Makes subsequent sampleAction calls on this thread deterministic.
+ * Used by the trainer when TrainingConfig::rngSeed is set so whole runs
+ * replay exactly.
+ *
+ * @param seed Seed value
+ */
+void seedThreadRng(std::uint64_t seed);
+
+/**
+ * @brief Serialize the calling thread's sampling RNG state
+ *
+ * The returned text captures the generator's exact position, so a run
+ * restored with restoreThreadRngState draws the same sample sequence
+ * the interrupted run would have. Used by the trainer's lossless
+ * checkpoints.
+ *
+ * @return Text encoding of the RNG state
+ */
+std::string saveThreadRngState();
+
+/**
+ * @brief Restore the calling thread's sampling RNG from saved state
+ * @param state Text produced by saveThreadRngState
+ * @return True if the state parsed cleanly
+ */
+bool restoreThreadRngState(const std::string& state);
+
 /**
  * @brief Create abstracted representation of hole cards
  * 
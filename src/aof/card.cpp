@@ -5,163 +5,144 @@
 
 namespace aof {
 
-// Static rank values mapping
-const std::unordered_map<std::string, int> Card::RANK_VALUES = {
-    {"2", 2}, {"3", 3}, {"4", 4}, {"5", 5}, {"6", 6}, {"7", 7}, {"8", 8},
-    {"9", 9}, {"10", 10}, {"J", 11}, {"Q", 12}, {"K", 13}, {"A", 14}
+namespace {
+
+/// Rank strings indexed by rank index (0 = "2" .. 12 = "A")
+const std::array<std::string, Card::NUM_RANKS> RANK_STRINGS = {
+    "2", "3", "4", "5", "6", "7", "8", "9", "10", "J", "Q", "K", "A"
 };
 
-// Card implementation
-Card::Card(std::string rank, std::string suit) 
-    : rank_(std::move(rank)), suit_(std::move(suit)) {
-    if (!isValid()) {
-        throw std::invalid_argument("Invalid card: " + rank_ + suit_);
+/// Suit strings indexed by suit index (0 = "c" .. 3 = "s")
+const std::array<std::string, Card::NUM_SUITS> SUIT_STRINGS = {
+    "c", "d", "h", "s"
+};
+
+const std::string EMPTY_STRING;
+
+int findRankIndex(const std::string& rank) noexcept {
+    for (int i = 0; i < Card::NUM_RANKS; ++i) {
+        if (RANK_STRINGS[i] == rank) {
+            return i;
+        }
     }
+    return -1;
 }
 
-int Card::getRankValue() const noexcept {
-    auto it = RANK_VALUES.find(rank_);
-    return (it != RANK_VALUES.end()) ? it->second : 0;
+int findSuitIndex(const std::string& suit) noexcept {
+    for (int i = 0; i < Card::NUM_SUITS; ++i) {
+        if (SUIT_STRINGS[i] == suit) {
+            return i;
+        }
+    }
+    return -1;
 }
 
-std::string Card::toString() const {
-    return rank_ + suit_;
+/// Constexpr table of all 52 cards in code order
+constexpr std::array<Card, 52> makeStandardDeckTable() {
+    std::array<Card, 52> deck{};
+    for (std::uint8_t code = 0; code < 52; ++code) {
+        deck[code] = Card::fromCode(code);
+    }
+    return deck;
 }
 
-bool Card::isValid() const noexcept {
-    static const std::vector<std::string> validSuits = {"h", "d", "c", "s"};
-    
-    return RANK_VALUES.count(rank_) > 0 && 
-           std::find(validSuits.begin(), validSuits.end(), suit_) != validSuits.end();
-}
+constexpr std::array<Card, 52> STANDARD_DECK = makeStandardDeckTable();
+
+} // namespace
+
+// Card implementation
+Card::Card(const std::string& rank, const std::string& suit) {
+    int rankIndex = findRankIndex(rank);
+    int suitIndex = findSuitIndex(suit);
+
+    if (rankIndex < 0 || suitIndex < 0) {
+        throw std::invalid_argument("Invalid card: " + rank + suit);
+    }
 
-bool Card::operator==(const Card& other) const noexcept {
-    return rank_ == other.rank_ && suit_ == other.suit_;
+    code_ = static_cast<std::uint8_t>(rankIndex * NUM_SUITS + suitIndex);
 }
 
-bool Card::operator!=(const Card& other) const noexcept {
-    return !(*this == other);
+const std::string& Card::getRank() const noexcept {
+    return isValid() ? RANK_STRINGS[getRankIndex()] : EMPTY_STRING;
 }
 
-bool Card::operator<(const Card& other) const noexcept {
-    int thisValue = getRankValue();
-    int otherValue = other.getRankValue();
-    
-    if (thisValue != otherValue) {
-        return thisValue < otherValue;
-    }
-    return suit_ < other.suit_;
+const std::string& Card::getSuit() const noexcept {
+    return isValid() ? SUIT_STRINGS[getSuitIndex()] : EMPTY_STRING;
 }
 
-// Deck implementation
-Deck::Deck(std::mt19937& rng) : rng_(rng) {
-    cards_ = createStandardDeck();
-    shuffle();
+std::string Card::toString() const {
+    return getRank() + getSuit();
 }
 
-Deck::Deck(std::uint32_t seed) : rng_(seed) {
-    cards_ = createStandardDeck();
-    shuffle();
+// Deck implementation
+Deck::Deck(std::uint64_t seed) noexcept : cards_(STANDARD_DECK), rng_(seed) {
 }
 
 Card Deck::dealCard() {
     if (isEmpty()) {
         throw std::runtime_error("Cannot deal from empty deck");
     }
-    
-    Card card = cards_.back();
-    cards_.pop_back();
-    return card;
+
+    // Fix this position with one partial Fisher-Yates step the first
+    // time it is dealt; replays after returnCard() reuse the same card
+    if (dealt_ == shuffled_) {
+        std::uint8_t pick = dealt_ +
+            static_cast<std::uint8_t>(rng_.bounded(DECK_CARDS - dealt_));
+        std::swap(cards_[dealt_], cards_[pick]);
+        ++shuffled_;
+    }
+
+    return cards_[dealt_++];
+}
+
+void Deck::returnCard(Card /* card */) {
+    if (dealt_ > 0) {
+        --dealt_;
+    }
 }
 
 std::vector<Card> Deck::dealCards(int count) {
     if (count < 0) {
         throw std::invalid_argument("Cannot deal negative number of cards");
     }
-    
-    if (static_cast<std::size_t>(count) > cards_.size()) {
+
+    if (static_cast<std::size_t>(count) > size()) {
         throw std::runtime_error("Not enough cards in deck");
     }
-    
+
     std::vector<Card> dealt;
     dealt.reserve(count);
-    
+
     for (int i = 0; i < count; ++i) {
         dealt.push_back(dealCard());
     }
-    
-    return dealt;
-}
 
-void Deck::reset() {
-    cards_ = createStandardDeck();
-    shuffle();
-}
-
-std::vector<Card> Deck::createStandardDeck() {
-    const std::vector<std::string> ranks = {"2", "3", "4", "5", "6", "7", "8", "9", 
-                                           "10", "J", "Q", "K", "A"};
-    const std::vector<std::string> suits = {"h", "d", "c", "s"};
-    
-    std::vector<Card> deck;
-    deck.reserve(52);
-    
-    for (const auto& rank : ranks) {
-        for (const auto& suit : suits) {
-            deck.emplace_back(rank, suit);
-        }
-    }
-    
-    return deck;
+    return dealt;
 }
 
-void Deck::shuffle() {
-    std::shuffle(cards_.begin(), cards_.end(), rng_);
+void Deck::reset() noexcept {
+    dealt_ = 0;
+    shuffled_ = 0;
 }
 
 // Utility functions
 namespace card_utils {
 
-bool areSuited(const Card& card1, const Card& card2) noexcept {
-    return card1.getSuit() == card2.getSuit();
-}
-
 std::string getAbstractedHoleCards(const Card& card1, const Card& card2) {
-    // Order cards by rank (higher first)
-    const Card* highCard = &card1;
-    const Card* lowCard = &card2;
-    
-    if (card1.getRankValue() < card2.getRankValue()) {
-        std::swap(highCard, lowCard);
-    }
-    
-    std::stringstream ss;
-    ss << highCard->getRank();
-    
-    // For pairs, just show the rank once
-    if (highCard->getRankValue() == lowCard->getRankValue()) {
-        ss << lowCard->getRank();
-    } else {
-        ss << lowCard->getRank();
-        ss << (areSuited(*highCard, *lowCard) ? "s" : "o");
-    }
-    
-    return ss.str();
+    // One table lookup; the labels are generated at compile time
+    return getBucketLabel(getBucketId(card1, card2));
 }
 
 const std::vector<std::string>& getAllRanks() {
-    static const std::vector<std::string> ranks = {
-        "2", "3", "4", "5", "6", "7", "8", "9", "10", "J", "Q", "K", "A"
-    };
+    static const std::vector<std::string> ranks(RANK_STRINGS.begin(), RANK_STRINGS.end());
     return ranks;
 }
 
 const std::vector<std::string>& getAllSuits() {
-    static const std::vector<std::string> suits = {"h", "d", "c", "s"};
+    static const std::vector<std::string> suits(SUIT_STRINGS.begin(), SUIT_STRINGS.end());
     return suits;
 }
 
 } // namespace card_utils
 
 } // namespace aof
-
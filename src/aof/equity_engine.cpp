@@ -0,0 +1,395 @@
+#include "aof/equity_engine.hpp"
+#include "aof/poker_evaluator.hpp"
+#include <algorithm>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+namespace aof {
+
+namespace {
+
+/// 169-bucket id for a hole card pair; layout shared with the solver's
+/// information set encoding via the compile-time table in card_utils
+int bucketId(const Card& card1, const Card& card2) noexcept {
+    return card_utils::getBucketId(card1, card2);
+}
+
+/// splitmix64 finalizer used to derive independent per-entry seeds
+std::uint64_t mixSeed(std::uint64_t x) noexcept {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+/**
+ * @brief Sample a concrete hole card pair belonging to a bucket
+ *
+ * Rejection-samples suits until both cards are free in `usedMask`.
+ * @return False if the bucket has no remaining combination
+ */
+bool sampleBucketCombo(int bucket, std::uint64_t& usedMask,
+                       std::mt19937_64& rng, Card& out1, Card& out2) {
+    int row = bucket / 13;
+    int col = bucket % 13;
+
+    // Decode the bucket layout back into ranks and suitedness
+    int highRank = std::max(row, col);
+    int lowRank = std::min(row, col);
+    bool pair = row == col;
+    bool suited = row > col;
+
+    std::uniform_int_distribution<int> suitDist(0, Card::NUM_SUITS - 1);
+    for (int attempt = 0; attempt < 64; ++attempt) {
+        int suit1 = suitDist(rng);
+        int suit2 = suitDist(rng);
+        if (pair || !suited) {
+            if (suit1 == suit2) continue;        // Pairs/offsuit need distinct suits
+        } else {
+            suit2 = suit1;                       // Suited shares one suit
+        }
+
+        Card card1 = Card::fromCode(static_cast<std::uint8_t>(highRank * 4 + suit1));
+        Card card2 = Card::fromCode(static_cast<std::uint8_t>(lowRank * 4 + suit2));
+        if ((usedMask & card1.getMask()) || (usedMask & card2.getMask())) {
+            continue;
+        }
+
+        usedMask |= card1.getMask() | card2.getMask();
+        out1 = card1;
+        out2 = card2;
+        return true;
+    }
+    return false;
+}
+
+/// Boards ranked per call into the bulk evaluator; bounds the flat
+/// board/value buffers at a few KB of stack
+constexpr int BOARD_BATCH = 128;
+
+/**
+ * @brief Accumulate pot shares over sampled boards for a fixed lineup
+ *
+ * Generates boards in batches with a partial Fisher-Yates over the
+ * residual packed-card deck (the swaps persist between boards, which
+ * keeps every draw uniform without re-copying the deck), ranks the whole
+ * lineup per batch through PokerEvaluator::evaluateBoardsFast and adds
+ * each board's win shares into `shares`.
+ */
+void accumulateBoardShares(const PokerEvaluator& evaluator,
+                           const Card* holeCards, int numContenders,
+                           std::uint64_t usedMask, int numBoards,
+                           FastRng& rng, double* shares) {
+    // Residual deck: packed codes of the cards no contender holds
+    std::array<std::uint8_t, 52> deck;
+    int deckSize = 0;
+    for (std::uint8_t code = 0; code < 52; ++code) {
+        if (!(usedMask & (std::uint64_t{1} << code))) {
+            deck[deckSize++] = code;
+        }
+    }
+
+    std::array<Card, BOARD_BATCH * GameConfig::COMMUNITY_CARDS> boards;
+    std::array<HandValue, BOARD_BATCH * GameConfig::NUM_PLAYERS> values;
+
+    for (int remaining = numBoards; remaining > 0;) {
+        int batch = std::min(remaining, BOARD_BATCH);
+
+        Card* out = boards.data();
+        for (int board = 0; board < batch; ++board) {
+            for (int i = 0; i < GameConfig::COMMUNITY_CARDS; ++i) {
+                int j = i + static_cast<int>(
+                    rng.bounded(static_cast<std::uint32_t>(deckSize - i)));
+                std::swap(deck[i], deck[j]);
+                *out++ = Card::fromCode(deck[i]);
+            }
+        }
+
+        evaluator.evaluateBoardsFast(holeCards, numContenders, boards.data(),
+                                     batch, values.data());
+
+        for (int board = 0; board < batch; ++board) {
+            const HandValue* boardValues = values.data() + board * numContenders;
+            HandValue best = 0;
+            int winnerCount = 0;
+            for (int i = 0; i < numContenders; ++i) {
+                if (boardValues[i] > best) {
+                    best = boardValues[i];
+                    winnerCount = 1;
+                } else if (boardValues[i] == best) {
+                    ++winnerCount;
+                }
+            }
+
+            double share = 1.0 / winnerCount;
+            for (int i = 0; i < numContenders; ++i) {
+                if (boardValues[i] == best) {
+                    shares[i] += share;
+                }
+            }
+        }
+        remaining -= batch;
+    }
+}
+
+} // namespace
+
+EquityEngine::EquityEngine(int samplesPerEntry, std::uint64_t seed)
+    : samplesPerEntry_(samplesPerEntry)
+    , seed_(seed)
+{
+    if (samplesPerEntry <= 0) {
+        throw std::invalid_argument("Samples per entry must be positive");
+    }
+}
+
+void EquityEngine::getEquities(const Card* holeCards, int numContenders,
+                               double* equities) const {
+    if (numContenders < 2 || numContenders > GameConfig::NUM_PLAYERS) {
+        throw std::invalid_argument("Equity queries need 2-4 contenders");
+    }
+
+    std::array<int, GameConfig::NUM_PLAYERS> buckets{};
+    std::array<int, GameConfig::NUM_PLAYERS> order{};
+    for (int i = 0; i < numContenders; ++i) {
+        buckets[i] = bucketId(holeCards[i * 2], holeCards[i * 2 + 1]);
+        order[i] = i;
+    }
+
+    // Canonical key: contenders sorted by bucket, one byte per slot
+    std::sort(order.begin(), order.begin() + numContenders,
+              [&](int a, int b) { return buckets[a] < buckets[b]; });
+
+    BucketKey key = 0;
+    std::array<int, GameConfig::NUM_PLAYERS> sortedBuckets{};
+    for (int i = 0; i < GameConfig::NUM_PLAYERS; ++i) {
+        int bucket = i < numContenders ? buckets[order[i]] : 0xFF;
+        sortedBuckets[i] = bucket;
+        key |= static_cast<BucketKey>(bucket) << (8 * i);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = table_.find(key);
+        if (it != table_.end()) {
+            for (int i = 0; i < numContenders; ++i) {
+                equities[order[i]] = it->second[i];
+            }
+            return;
+        }
+    }
+
+    // Estimate outside the lock so concurrent queries for other entries
+    // are not serialized; a duplicate estimate for the same key is
+    // harmless (both produce the same deterministic values)
+    Entry entry = computeEntry(sortedBuckets.data(), numContenders);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        table_.emplace(key, entry);
+    }
+
+    for (int i = 0; i < numContenders; ++i) {
+        equities[order[i]] = entry[i];
+    }
+}
+
+void EquityEngine::estimateEquities(const Card* holeCards, int numContenders,
+                                    int numBoards, std::uint64_t seed,
+                                    double* equities) const {
+    if (numContenders < 2 || numContenders > GameConfig::NUM_PLAYERS) {
+        throw std::invalid_argument("Equity queries need 2-4 contenders");
+    }
+    if (numBoards <= 0) {
+        throw std::invalid_argument("Board count must be positive");
+    }
+
+    std::uint64_t usedMask = 0;
+    for (int i = 0; i < numContenders * 2; ++i) {
+        if (!holeCards[i].isValid() || (usedMask & holeCards[i].getMask())) {
+            throw std::invalid_argument("Hole cards must be valid and distinct");
+        }
+        usedMask |= holeCards[i].getMask();
+    }
+
+    FastRng rng(mixSeed(seed_ ^ mixSeed(seed)));
+    PokerEvaluator evaluator;
+    std::array<double, GameConfig::NUM_PLAYERS> shares{};
+    accumulateBoardShares(evaluator, holeCards, numContenders, usedMask,
+                          numBoards, rng, shares.data());
+
+    // Normalize exactly so the equities sum to 1
+    double total = 0.0;
+    for (int i = 0; i < numContenders; ++i) {
+        total += shares[i];
+    }
+    for (int i = 0; i < numContenders; ++i) {
+        equities[i] = shares[i] / total;
+    }
+}
+
+EquityEngine::Entry EquityEngine::computeEntry(const int* sortedBuckets,
+                                               int numContenders) const {
+    BucketKey key = 0;
+    for (int i = 0; i < numContenders; ++i) {
+        key |= static_cast<BucketKey>(sortedBuckets[i]) << (8 * i);
+    }
+    std::mt19937_64 rng(mixSeed(seed_ ^ key));
+    FastRng boardRng(mixSeed(seed_ ^ key ^ 0x9E3779B97F4A7C15ULL));
+
+    PokerEvaluator evaluator;
+    Entry shares{};
+
+    // Boards are sampled in batches per concrete hole-card deal, so the
+    // per-deal setup (bucket rejection sampling, residual deck) is
+    // amortized across many bulk-evaluated boards
+    constexpr int BOARDS_PER_DEAL = 32;
+    int numDeals = (samplesPerEntry_ + BOARDS_PER_DEAL - 1) / BOARDS_PER_DEAL;
+
+    int validSamples = 0;
+    for (int deal = 0; deal < numDeals; ++deal) {
+        std::uint64_t usedMask = 0;
+        std::array<Card, GameConfig::NUM_PLAYERS * 2> holeCards;
+
+        bool dealt = true;
+        for (int i = 0; i < numContenders; ++i) {
+            if (!sampleBucketCombo(sortedBuckets[i], usedMask, rng,
+                                   holeCards[i * 2], holeCards[i * 2 + 1])) {
+                dealt = false;
+                break;
+            }
+        }
+        if (!dealt) {
+            continue;        // Bucket combinations collided (e.g. four of a pair)
+        }
+
+        accumulateBoardShares(evaluator, holeCards.data(), numContenders,
+                              usedMask, BOARDS_PER_DEAL, boardRng,
+                              shares.data());
+        validSamples += BOARDS_PER_DEAL;
+    }
+
+    if (validSamples == 0) {
+        throw std::runtime_error("Equity estimation produced no valid deals");
+    }
+
+    // Identical buckets are strategically identical: average their slots
+    // so the tuple's equities do not depend on sampling noise ordering
+    for (int i = 0; i < numContenders;) {
+        int j = i + 1;
+        while (j < numContenders && sortedBuckets[j] == sortedBuckets[i]) {
+            ++j;
+        }
+        double mean = 0.0;
+        for (int k = i; k < j; ++k) {
+            mean += shares[k];
+        }
+        mean /= (j - i);
+        for (int k = i; k < j; ++k) {
+            shares[k] = mean;
+        }
+        i = j;
+    }
+
+    // Normalize exactly so expected returns conserve the pot
+    double total = 0.0;
+    for (int i = 0; i < numContenders; ++i) {
+        total += shares[i];
+    }
+    Entry entry{};
+    for (int i = 0; i < numContenders; ++i) {
+        entry[i] = shares[i] / total;
+    }
+    return entry;
+}
+
+bool EquityEngine::loadTable(const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::string line;
+    if (!std::getline(file, line) || line.rfind("# AoF equity table", 0) != 0) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream ss(line);
+        int numContenders = 0;
+        if (!(ss >> numContenders) ||
+            numContenders < 2 || numContenders > GameConfig::NUM_PLAYERS) {
+            continue;
+        }
+
+        BucketKey key = 0;
+        bool valid = true;
+        for (int i = 0; i < GameConfig::NUM_PLAYERS; ++i) {
+            int bucket = 0xFF;
+            if (i < numContenders && !(ss >> bucket)) {
+                valid = false;
+                break;
+            }
+            key |= static_cast<BucketKey>(bucket & 0xFF) << (8 * i);
+        }
+
+        Entry entry{};
+        for (int i = 0; valid && i < numContenders; ++i) {
+            valid = static_cast<bool>(ss >> entry[i]);
+        }
+        if (valid) {
+            table_[key] = entry;
+        }
+    }
+    return true;
+}
+
+bool EquityEngine::saveTable(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    file << "# AoF equity table (samples per entry: " << samplesPerEntry_ << ")\n";
+    file << "# contenders bucket... equity...\n";
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    file.precision(12);
+    for (const auto& [key, entry] : table_) {
+        int numContenders = 0;
+        std::array<int, GameConfig::NUM_PLAYERS> buckets{};
+        for (int i = 0; i < GameConfig::NUM_PLAYERS; ++i) {
+            int bucket = static_cast<int>((key >> (8 * i)) & 0xFF);
+            if (bucket == 0xFF) {
+                break;
+            }
+            buckets[numContenders++] = bucket;
+        }
+
+        file << numContenders;
+        for (int i = 0; i < numContenders; ++i) {
+            file << ' ' << buckets[i];
+        }
+        for (int i = 0; i < numContenders; ++i) {
+            file << ' ' << entry[i];
+        }
+        file << '\n';
+    }
+    return true;
+}
+
+std::size_t EquityEngine::tableSize() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return table_.size();
+}
+
+} // namespace aof
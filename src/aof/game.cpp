@@ -45,6 +45,10 @@ std::unique_ptr<GameState> Game::createInitialState() const {
     return std::make_unique<GameState>(this);
 }
 
+std::unique_ptr<GameState> Game::createInitialState(std::uint64_t deckSeed) const {
+    return std::make_unique<GameState>(this, deckSeed);
+}
+
 double Game::getInitialStack(int player) const {
     if (player < 0 || player >= GameConfig::NUM_PLAYERS) {
         throw std::invalid_argument("Invalid player index: " + std::to_string(player));
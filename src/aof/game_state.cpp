@@ -1,26 +1,55 @@
 #include "aof/game_state.hpp"
+#include "aof/profiling.hpp"
 #include "aof/game.hpp"
 #include "aof/game_config.hpp"
+#include "aof/equity_engine.hpp"
 #include "aof/poker_evaluator.hpp"
 #include <algorithm>
 #include <sstream>
 #include <stdexcept>
 #include <iostream>
+#include <type_traits>
 
 namespace aof {
 
+// The MCCFR traversal copies states in bulk; keep the state a flat,
+// allocation-free value type
+static_assert(std::is_trivially_copyable_v<GameState>,
+              "GameState must stay trivially copyable");
+
+namespace {
+
+/// Number of set bits in a player mask
+inline int maskCount(std::uint8_t mask) noexcept {
+    int count = 0;
+    while (mask != 0) {
+        mask &= static_cast<std::uint8_t>(mask - 1);
+        ++count;
+    }
+    return count;
+}
+
+} // namespace
+
 GameState::GameState(const Game* game)
+    : GameState(game, std::random_device{}())
+{
+}
+
+GameState::GameState(const Game* game, std::uint64_t deckSeed)
     : game_(game)
     , gameOver_(false)
     , nextPlayer_(0)
     , pot_(game->getSmallBlind() + game->getBigBlind())  // Initial pot with blinds
-    , initialStacks_(GameConfig::NUM_PLAYERS)
-    , playerStacks_(GameConfig::NUM_PLAYERS)
-    , folded_(GameConfig::NUM_PLAYERS, false)
-    , deck_(std::make_unique<Deck>())
+    , initialStacks_()
+    , playerStacks_()
+    , foldedMask_(0)
+    , allInMask_(0)
+    , deck_(deckSeed)
     , holeCards_()
     , communityCards_()
     , sidePots_()
+    , numSidePots_(0)
 {
     // Initialize stacks
     for (int i = 0; i < GameConfig::NUM_PLAYERS; ++i) {
@@ -33,40 +62,6 @@ GameState::GameState(const Game* game)
     playerStacks_[1] -= game->getBigBlind();    // Big blind
 }
 
-GameState::GameState(const GameState& other)
-    : game_(other.game_)
-    , gameOver_(other.gameOver_)
-    , nextPlayer_(other.nextPlayer_)
-    , pot_(other.pot_)
-    , initialStacks_(other.initialStacks_)
-    , playerStacks_(other.playerStacks_)
-    , folded_(other.folded_)
-    , allInPlayers_(other.allInPlayers_)
-    , deck_(other.deck_ ? std::make_unique<Deck>(*other.deck_) : nullptr)
-    , holeCards_(other.holeCards_)
-    , communityCards_(other.communityCards_)
-    , sidePots_(other.sidePots_)
-{
-}
-
-GameState& GameState::operator=(const GameState& other) {
-    if (this != &other) {
-        game_ = other.game_;
-        gameOver_ = other.gameOver_;
-        nextPlayer_ = other.nextPlayer_;
-        pot_ = other.pot_;
-        initialStacks_ = other.initialStacks_;
-        playerStacks_ = other.playerStacks_;
-        folded_ = other.folded_;
-        allInPlayers_ = other.allInPlayers_;
-        deck_ = other.deck_ ? std::make_unique<Deck>(*other.deck_) : nullptr;
-        holeCards_ = other.holeCards_;
-        communityCards_ = other.communityCards_;
-        sidePots_ = other.sidePots_;
-    }
-    return *this;
-}
-
 bool GameState::isChanceNode() const noexcept {
     return holeCards_.empty() && !gameOver_;
 }
@@ -88,7 +83,7 @@ std::vector<Action> GameState::getLegalActions() const {
     }
     
     int player = getCurrentPlayer();
-    if (player < 0 || folded_[player]) {
+    if (player < 0 || hasFolded(player)) {
         return {};
     }
     
@@ -96,6 +91,7 @@ std::vector<Action> GameState::getLegalActions() const {
 }
 
 void GameState::applyAction(Action action) {
+    AOF_PROF_COUNT(STATE_ACTION);
     if (isChanceNode()) {
         if (action != Action::DEAL) {
             throw std::invalid_argument("Only DEAL action allowed at chance node");
@@ -122,14 +118,14 @@ void GameState::applyAction(Action action) {
     // Apply the action
     switch (action) {
         case Action::FOLD:
-            folded_[player] = true;
+            foldedMask_ |= static_cast<std::uint8_t>(1u << player);
             break;
             
         case Action::ALL_IN: {
             double amount = playerStacks_[player];
             pot_ += amount;
             playerStacks_[player] = 0.0;
-            allInPlayers_.insert(player);
+            allInMask_ |= static_cast<std::uint8_t>(1u << player);
             break;
         }
         
@@ -145,6 +141,57 @@ void GameState::applyAction(Action action) {
     }
 }
 
+void GameState::applyAction(Action action, UndoToken& token) {
+    token.action = action;
+    token.player = isChanceNode() ? -1 : getCurrentPlayer();
+    token.prevNextPlayer = nextPlayer_;
+    token.prevPot = pot_;
+    token.prevStack = (token.player >= 0) ? playerStacks_[token.player] : 0.0;
+
+    bool hadCommunityCards = !communityCards_.empty();
+    applyAction(action);
+
+    token.endedGame = gameOver_;
+    token.dealtCommunity = !hadCommunityCards && !communityCards_.empty();
+}
+
+void GameState::undoAction(const UndoToken& token) {
+    if (token.endedGame) {
+        gameOver_ = false;
+        numSidePots_ = 0;
+
+        if (token.dealtCommunity) {
+            // Return community cards in reverse deal order so the deck is
+            // bit-identical to its state before the game ended
+            for (std::size_t i = communityCards_.size(); i > 0; --i) {
+                deck_.returnCard(communityCards_[i - 1]);
+            }
+            communityCards_.clear();
+        }
+    }
+
+    switch (token.action) {
+        case Action::DEAL:
+            for (std::size_t i = holeCards_.size(); i > 0; --i) {
+                deck_.returnCard(holeCards_[i - 1]);
+            }
+            holeCards_.clear();
+            break;
+
+        case Action::FOLD:
+            foldedMask_ &= static_cast<std::uint8_t>(~(1u << token.player));
+            break;
+
+        case Action::ALL_IN:
+            playerStacks_[token.player] = token.prevStack;
+            pot_ = token.prevPot;
+            allInMask_ &= static_cast<std::uint8_t>(~(1u << token.player));
+            break;
+    }
+
+    nextPlayer_ = token.prevNextPlayer;
+}
+
 PlayerUtilities GameState::getReturns() const {
     if (!gameOver_) {
         throw std::runtime_error("Cannot get returns for non-terminal state");
@@ -153,57 +200,79 @@ PlayerUtilities GameState::getReturns() const {
     PlayerUtilities returns(GameConfig::NUM_PLAYERS, 0.0);
     
     // Calculate net change for each player (winnings - initial investment)
-    std::vector<double> investments(GameConfig::NUM_PLAYERS, 0.0);
+    std::array<double, GameConfig::NUM_PLAYERS> investments{};
     
     // Calculate actual investment for each player
     for (int i = 0; i < GameConfig::NUM_PLAYERS; ++i) {
         investments[i] = initialStacks_[i] - playerStacks_[i];
     }
     
-    // Distribute side pots to winners
-    PokerEvaluator evaluator;
-    for (const auto& [potAmount, contributors] : sidePots_) {
-        if (contributors.empty()) continue;
-        
-        // Find best hand among contributors
-        std::vector<std::pair<HandScore, int>> playerScores;
-        
-        for (int player : contributors) {
-            if (!folded_[player]) {
-                std::vector<Card> playerHoleCards = {
-                    holeCards_[player * 2],
-                    holeCards_[player * 2 + 1]
-                };
-                
-                HandScore score = evaluator.evaluateHand(playerHoleCards, communityCards_);
-                playerScores.emplace_back(score, player);
+    const EquityEngine* equityEngine = game_ ? game_->getEquityEngine() : nullptr;
+    if (equityEngine) {
+        // Expected-value terminal mode: award each pot by all-in equity
+        // instead of the outcome of the one board this deal happened to see
+        for (int potIndex = 0; potIndex < numSidePots_; ++potIndex) {
+            const SidePot& pot = sidePots_[potIndex];
+            std::array<int, GameConfig::NUM_PLAYERS> contenders{};
+            std::array<Card, GameConfig::NUM_PLAYERS * 2> contenderHoles;
+            int numContenders = 0;
+            for (int player = 0; player < GameConfig::NUM_PLAYERS; ++player) {
+                if (((pot.eligibleMask >> player) & 1) == 0) continue;
+                contenders[numContenders] = player;
+                contenderHoles[numContenders * 2] = holeCards_[player * 2];
+                contenderHoles[numContenders * 2 + 1] = holeCards_[player * 2 + 1];
+                ++numContenders;
             }
-        }
-        
-        if (playerScores.empty()) continue;
-        
-        // Find winners (players with best hand)
-        std::sort(playerScores.begin(), playerScores.end(),
-                 [&evaluator](const auto& a, const auto& b) {
-                     return evaluator.compareHands(a.first, b.first) > 0;
-                 });
-        
-        std::vector<int> winners;
-        winners.push_back(playerScores[0].second);
-        
-        // Find ties
-        for (std::size_t i = 1; i < playerScores.size(); ++i) {
-            if (evaluator.compareHands(playerScores[0].first, playerScores[i].first) == 0) {
-                winners.push_back(playerScores[i].second);
-            } else {
-                break;
+
+            if (numContenders == 0) continue;
+
+            if (numContenders == 1) {
+                returns[contenders[0]] += pot.amount;
+                continue;
+            }
+
+            std::array<double, GameConfig::NUM_PLAYERS> equities{};
+            equityEngine->getEquities(contenderHoles.data(), numContenders,
+                                      equities.data());
+            for (int i = 0; i < numContenders; ++i) {
+                returns[contenders[i]] += pot.amount * equities[i];
             }
         }
-        
-        // Split pot among winners
-        double sharePerWinner = potAmount / winners.size();
-        for (int winner : winners) {
-            returns[winner] += sharePerWinner;
+    } else {
+        // Rank every player's hand against the board once, then reuse the
+        // values across all side pots
+        PokerEvaluator evaluator;
+        std::array<HandValue, GameConfig::NUM_PLAYERS> handValues{};
+        evaluator.evaluateHandsFast(holeCards_.begin(), GameConfig::NUM_PLAYERS,
+                                   communityCards_.begin(), handValues.data());
+
+        for (int potIndex = 0; potIndex < numSidePots_; ++potIndex) {
+            const SidePot& pot = sidePots_[potIndex];
+            if (pot.eligibleMask == 0) continue;
+
+            // Find best hand among eligible players
+            HandValue bestValue = 0;
+            int winnerCount = 0;
+            for (int player = 0; player < GameConfig::NUM_PLAYERS; ++player) {
+                if (((pot.eligibleMask >> player) & 1) == 0) continue;
+                if (handValues[player] > bestValue) {
+                    bestValue = handValues[player];
+                    winnerCount = 1;
+                } else if (handValues[player] == bestValue) {
+                    ++winnerCount;
+                }
+            }
+
+            if (winnerCount == 0) continue;
+
+            // Split pot among winners
+            double sharePerWinner = pot.amount / winnerCount;
+            for (int player = 0; player < GameConfig::NUM_PLAYERS; ++player) {
+                if (((pot.eligibleMask >> player) & 1) != 0 &&
+                    handValues[player] == bestValue) {
+                    returns[player] += sharePerWinner;
+                }
+            }
         }
     }
     
@@ -240,15 +309,16 @@ std::string GameState::toString() const {
     ss << "]\n";
     
     ss << "  Folded: [";
-    for (std::size_t i = 0; i < folded_.size(); ++i) {
+    for (int i = 0; i < GameConfig::NUM_PLAYERS; ++i) {
         if (i > 0) ss << ", ";
-        ss << (folded_[i] ? "true" : "false");
+        ss << (hasFolded(i) ? "true" : "false");
     }
     ss << "]\n";
     
     ss << "  All-in Players: {";
     bool first = true;
-    for (int player : allInPlayers_) {
+    for (int player = 0; player < GameConfig::NUM_PLAYERS; ++player) {
+        if (!isAllIn(player)) continue;
         if (!first) ss << ", ";
         ss << player;
         first = false;
@@ -282,104 +352,137 @@ void GameState::dealHoleCards() {
         return;  // Already dealt
     }
     
-    holeCards_ = deck_->dealCards(GameConfig::NUM_PLAYERS * GameConfig::HOLE_CARDS_PER_PLAYER);
+    for (int i = 0; i < GameConfig::NUM_PLAYERS * GameConfig::HOLE_CARDS_PER_PLAYER; ++i) {
+        holeCards_.push_back(deck_.dealCard());
+    }
 }
 
 void GameState::advanceToNextPlayer() {
     do {
         nextPlayer_ = (nextPlayer_ + 1) % GameConfig::NUM_PLAYERS;
-    } while (folded_[nextPlayer_] && getActivePlayerCount() > 1);
+    } while (hasFolded(nextPlayer_) && getActivePlayerCount() > 1);
 }
 
 void GameState::handleGameEnd() {
     // Deal community cards if not already dealt
     if (communityCards_.empty()) {
-        communityCards_ = deck_->dealCards(GameConfig::COMMUNITY_CARDS);
+        for (int i = 0; i < GameConfig::COMMUNITY_CARDS; ++i) {
+            communityCards_.push_back(deck_.dealCard());
+        }
     }
     
     calculateSidePots();
 }
 
 void GameState::calculateSidePots() {
-    sidePots_.clear();
-    
-    // Calculate total contribution per player
-    std::vector<std::pair<double, int>> contributions;  // (amount, player)
-    
+    numSidePots_ = 0;
+
+    // Total contribution per seat; the game is fixed at 4 players so the
+    // whole computation runs on flat stack arrays and bitmasks
+    std::array<double, GameConfig::NUM_PLAYERS> contribution;
+    double totalPot = 0.0;
+    for (int i = 0; i < GameConfig::NUM_PLAYERS; ++i) {
+        contribution[i] = initialStacks_[i] - playerStacks_[i];
+        totalPot += contribution[i];
+    }
+
+    std::uint8_t activeMask =
+        static_cast<std::uint8_t>(~foldedMask_ & ((1u << GameConfig::NUM_PLAYERS) - 1));
+
+    // Fast path for the dominant case: every non-folded player is in for
+    // the same amount and no folder put in more, so a single main pot
+    // holds everything. With equal starting stacks this covers almost
+    // every terminal state.
+    double activeLevel = -1.0;
+    bool singlePot = true;
     for (int i = 0; i < GameConfig::NUM_PLAYERS; ++i) {
-        double totalContribution = initialStacks_[i] - playerStacks_[i];
-        if (totalContribution > 0) {
-            contributions.emplace_back(totalContribution, i);
+        if ((activeMask >> i) & 1) {
+            if (activeLevel < 0.0) {
+                activeLevel = contribution[i];
+            } else if (contribution[i] != activeLevel) {
+                singlePot = false;
+            }
         }
     }
-    
-    // Sort by contribution amount
-    std::sort(contributions.begin(), contributions.end());
-    
-    // Create side pots
-    double prevAmount = 0.0;
-    std::set<int> eligiblePlayers;
-    
-    // All non-folded players are initially eligible
     for (int i = 0; i < GameConfig::NUM_PLAYERS; ++i) {
-        if (!folded_[i]) {
-            eligiblePlayers.insert(i);
+        if (((activeMask >> i) & 1) == 0 && contribution[i] > activeLevel) {
+            singlePot = false;
         }
     }
-    
-    // Count total number of players who contributed at each level
-    std::vector<int> allPlayers;
+    if (singlePot && activeMask != 0 && totalPot > 0.0) {
+        sidePots_[numSidePots_++] = SidePot{totalPot, activeMask};
+        return;
+    }
+
+    // General case: order the four contribution levels with a 5-comparator
+    // sorting network instead of std::sort
+    struct Level {
+        double amount;
+        int player;
+    };
+    std::array<Level, GameConfig::NUM_PLAYERS> levels{{
+        {contribution[0], 0}, {contribution[1], 1},
+        {contribution[2], 2}, {contribution[3], 3}}};
+    auto compareSwap = [](Level& a, Level& b) {
+        if (b.amount < a.amount) {
+            std::swap(a, b);
+        }
+    };
+    compareSwap(levels[0], levels[1]);
+    compareSwap(levels[2], levels[3]);
+    compareSwap(levels[0], levels[2]);
+    compareSwap(levels[1], levels[3]);
+    compareSwap(levels[1], levels[2]);
+
+    // Walk the levels bottom-up; non-folded players are initially eligible
+    // and each contributor drops out of deeper layers once its
+    // contribution is spent. Zero contributors (an active seat that never
+    // paid in) stay eligible throughout.
+    double prevAmount = 0.0;
+    std::uint8_t eligibleMask = activeMask;
+    std::uint8_t contributorMask = 0;
     for (int i = 0; i < GameConfig::NUM_PLAYERS; ++i) {
-        if (initialStacks_[i] - playerStacks_[i] > 0) {
-            allPlayers.push_back(i);
+        if (levels[i].amount > 0.0) {
+            contributorMask |= static_cast<std::uint8_t>(1u << levels[i].player);
         }
     }
-    
-    std::set<int> remainingContributors(allPlayers.begin(), allPlayers.end());
-    
-    for (const auto& [amount, player] : contributions) {
-        if (amount > prevAmount && !eligiblePlayers.empty()) {
+
+    for (int i = 0; i < GameConfig::NUM_PLAYERS; ++i) {
+        const auto& [amount, player] = levels[i];
+        if (amount <= 0.0) {
+            continue;
+        }
+
+        if (amount > prevAmount && eligibleMask != 0) {
             // Pot increment includes contributions from ALL players at this level
-            double potIncrement = (amount - prevAmount) * remainingContributors.size();
+            double potIncrement = (amount - prevAmount) * maskCount(contributorMask);
             if (potIncrement > 0) {
-                sidePots_.emplace_back(potIncrement, 
-                                      std::vector<int>(eligiblePlayers.begin(), eligiblePlayers.end()));
+                sidePots_[numSidePots_++] = SidePot{potIncrement, eligibleMask};
             }
         }
-        
+
         // Player is no longer eligible for future side pots (but contributed to this level)
-        eligiblePlayers.erase(player);
-        remainingContributors.erase(player);
+        eligibleMask &= static_cast<std::uint8_t>(~(1u << player));
+        contributorMask &= static_cast<std::uint8_t>(~(1u << player));
         prevAmount = amount;
     }
 }
 
 bool GameState::shouldGameEnd() const {
-    int activeCount = getActivePlayerCount();
-    
+    std::uint8_t activeMask =
+        static_cast<std::uint8_t>(~foldedMask_ & ((1u << GameConfig::NUM_PLAYERS) - 1));
+
     // Game ends if ≤1 active players
-    if (activeCount <= 1) {
+    if (maskCount(activeMask) <= 1) {
         return true;
     }
-    
+
     // Game ends if all active players are all-in
-    for (int i = 0; i < GameConfig::NUM_PLAYERS; ++i) {
-        if (!folded_[i] && allInPlayers_.count(i) == 0) {
-            return false;  // Found active player who hasn't gone all-in
-        }
-    }
-    
-    return true;  // All active players are all-in
+    return (activeMask & static_cast<std::uint8_t>(~allInMask_)) == 0;
 }
 
 int GameState::getActivePlayerCount() const {
-    int count = 0;
-    for (int i = 0; i < GameConfig::NUM_PLAYERS; ++i) {
-        if (!folded_[i]) {
-            ++count;
-        }
-    }
-    return count;
+    return GameConfig::NUM_PLAYERS - maskCount(foldedMask_);
 }
 
 } // namespace aof
@@ -1,12 +1,163 @@
 #include "aof/poker_evaluator.hpp"
+#include "aof/profiling.hpp"
 #include <algorithm>
 #include <stdexcept>
 #include <set>
+#include <bitset>
 
 namespace aof {
 
+namespace {
+
+/// Straight high-card value (5-14, 0 if none) for every 13-bit rank mask
+constexpr std::array<std::uint8_t, 8192> makeStraightTable() {
+    std::array<std::uint8_t, 8192> table{};
+    constexpr int WHEEL_MASK = (1 << 12) | 0xF;  // A-2-3-4-5 (ace is index 12)
+
+    for (int mask = 0; mask < 8192; ++mask) {
+        std::uint8_t high = 0;
+        if ((mask & WHEEL_MASK) == WHEEL_MASK) {
+            high = 5;
+        }
+        for (int top = 4; top <= 12; ++top) {
+            int run = 0x1F << (top - 4);
+            if ((mask & run) == run) {
+                high = static_cast<std::uint8_t>(top + 2);
+            }
+        }
+        table[mask] = high;
+    }
+    return table;
+}
+
+constexpr std::array<std::uint8_t, 8192> STRAIGHT_TABLE = makeStraightTable();
+
+inline int countBits(std::uint16_t mask) noexcept {
+    return static_cast<int>(std::bitset<16>(mask).count());
+}
+
+/// Pack hand rank and up to five tiebreaker card values into a HandValue
+constexpr HandValue packValue(HandRank rank, int t0 = 0, int t1 = 0,
+                              int t2 = 0, int t3 = 0, int t4 = 0) noexcept {
+    return (static_cast<HandValue>(rank) << 20) |
+           (static_cast<HandValue>(t0) << 16) |
+           (static_cast<HandValue>(t1) << 12) |
+           (static_cast<HandValue>(t2) << 8) |
+           (static_cast<HandValue>(t3) << 4) |
+           static_cast<HandValue>(t4);
+}
+
+/// Write the card values of the top `count` set ranks of `mask` into `out`
+inline void takeTopRanks(std::uint16_t mask, int count, int* out) noexcept {
+    int found = 0;
+    for (int idx = 12; idx >= 0 && found < count; --idx) {
+        if (mask & (1 << idx)) {
+            out[found++] = idx + 2;
+        }
+    }
+    while (found < count) {
+        out[found++] = 0;
+    }
+}
+
+/// Evaluate 7 cards given their per-suit rank masks
+HandValue evaluateSeven(const std::uint16_t suitMasks[4]) noexcept {
+    // Straight flush / flush (at most one suit can hold 5+ of 7 cards)
+    for (int suit = 0; suit < 4; ++suit) {
+        if (countBits(suitMasks[suit]) >= 5) {
+            int sfHigh = STRAIGHT_TABLE[suitMasks[suit]];
+            if (sfHigh > 0) {
+                return packValue(HandRank::STRAIGHT_FLUSH, sfHigh);
+            }
+            int tops[5];
+            takeTopRanks(suitMasks[suit], 5, tops);
+            return packValue(HandRank::FLUSH, tops[0], tops[1], tops[2], tops[3], tops[4]);
+        }
+    }
+
+    std::uint16_t allMask = 0;
+    std::uint8_t rankCounts[13] = {};
+    for (int suit = 0; suit < 4; ++suit) {
+        allMask |= suitMasks[suit];
+        for (int idx = 0; idx < 13; ++idx) {
+            rankCounts[idx] += (suitMasks[suit] >> idx) & 1;
+        }
+    }
+
+    // Collect made hands scanning from high rank to low
+    int quad = 0, trips1 = 0, trips2 = 0, pair1 = 0, pair2 = 0;
+    for (int idx = 12; idx >= 0; --idx) {
+        switch (rankCounts[idx]) {
+            case 4:
+                if (quad == 0) quad = idx + 2;
+                break;
+            case 3:
+                if (trips1 == 0) trips1 = idx + 2;
+                else if (trips2 == 0) trips2 = idx + 2;
+                break;
+            case 2:
+                if (pair1 == 0) pair1 = idx + 2;
+                else if (pair2 == 0) pair2 = idx + 2;
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (quad > 0) {
+        int kicker = 0;
+        for (int idx = 12; idx >= 0; --idx) {
+            if ((allMask & (1 << idx)) && idx + 2 != quad) {
+                kicker = idx + 2;
+                break;
+            }
+        }
+        return packValue(HandRank::FOUR_OF_A_KIND, quad, kicker);
+    }
+
+    if (trips1 > 0 && (trips2 > 0 || pair1 > 0)) {
+        return packValue(HandRank::FULL_HOUSE, trips1, std::max(trips2, pair1));
+    }
+
+    int straightHigh = STRAIGHT_TABLE[allMask];
+    if (straightHigh > 0) {
+        return packValue(HandRank::STRAIGHT, straightHigh);
+    }
+
+    if (trips1 > 0) {
+        int kickers[2] = {0, 0};
+        takeTopRanks(static_cast<std::uint16_t>(allMask & ~(1 << (trips1 - 2))), 2, kickers);
+        return packValue(HandRank::THREE_OF_A_KIND, trips1, kickers[0], kickers[1]);
+    }
+
+    if (pair1 > 0 && pair2 > 0) {
+        int kicker[1] = {0};
+        std::uint16_t rest = static_cast<std::uint16_t>(
+            allMask & ~(1 << (pair1 - 2)) & ~(1 << (pair2 - 2)));
+        takeTopRanks(rest, 1, kicker);
+        return packValue(HandRank::TWO_PAIR, pair1, pair2, kicker[0]);
+    }
+
+    if (pair1 > 0) {
+        int kickers[3] = {0, 0, 0};
+        takeTopRanks(static_cast<std::uint16_t>(allMask & ~(1 << (pair1 - 2))), 3, kickers);
+        return packValue(HandRank::PAIR, pair1, kickers[0], kickers[1], kickers[2]);
+    }
+
+    int tops[5];
+    takeTopRanks(allMask, 5, tops);
+    return packValue(HandRank::HIGH_CARD, tops[0], tops[1], tops[2], tops[3], tops[4]);
+}
+
+inline void addCardToMasks(std::uint16_t suitMasks[4], Card card) noexcept {
+    suitMasks[card.getSuitIndex()] |= static_cast<std::uint16_t>(1 << card.getRankIndex());
+}
+
+} // namespace
+
 HandScore PokerEvaluator::evaluateHand(const std::vector<Card>& holeCards,
                                       const std::vector<Card>& communityCards) const {
+    AOF_PROF_COUNT(HAND_EVAL);
     if (holeCards.size() != 2) {
         throw std::invalid_argument("Must have exactly 2 hole cards");
     }
@@ -158,6 +309,70 @@ HandScore PokerEvaluator::evaluateFiveCardHand(const std::vector<Card>& hand) co
     return makeScore(HandRank::HIGH_CARD, highCards);
 }
 
+HandValue PokerEvaluator::evaluateHandFast(Card hole1, Card hole2,
+                                          const Card* communityCards) const noexcept {
+    AOF_PROF_COUNT(HAND_EVAL);
+    std::uint16_t suitMasks[4] = {0, 0, 0, 0};
+
+    addCardToMasks(suitMasks, hole1);
+    addCardToMasks(suitMasks, hole2);
+    for (int i = 0; i < 5; ++i) {
+        addCardToMasks(suitMasks, communityCards[i]);
+    }
+
+    return evaluateSeven(suitMasks);
+}
+
+void PokerEvaluator::evaluateHandsFast(const Card* holeCards, int numPlayers,
+                                      const Card* communityCards,
+                                      HandValue* results) const noexcept {
+    // Build the board masks once and reuse them for every player
+    std::uint16_t boardMasks[4] = {0, 0, 0, 0};
+    for (int i = 0; i < 5; ++i) {
+        addCardToMasks(boardMasks, communityCards[i]);
+    }
+
+    for (int player = 0; player < numPlayers; ++player) {
+        std::uint16_t suitMasks[4] = {boardMasks[0], boardMasks[1],
+                                      boardMasks[2], boardMasks[3]};
+        addCardToMasks(suitMasks, holeCards[player * 2]);
+        addCardToMasks(suitMasks, holeCards[player * 2 + 1]);
+
+        results[player] = evaluateSeven(suitMasks);
+    }
+}
+
+void PokerEvaluator::evaluateBoardsFast(const Card* holeCards, int numPlayers,
+                                       const Card* boards, int numBoards,
+                                       HandValue* results) const noexcept {
+    // Hoist each player's hole-card masks out of the board loop; they are
+    // identical for every board in the batch
+    constexpr int MAX_LINEUP = 8;
+    std::uint16_t holeMasks[MAX_LINEUP][4] = {};
+    for (int player = 0; player < numPlayers; ++player) {
+        addCardToMasks(holeMasks[player], holeCards[player * 2]);
+        addCardToMasks(holeMasks[player], holeCards[player * 2 + 1]);
+    }
+
+    for (int board = 0; board < numBoards; ++board) {
+        std::uint16_t boardMasks[4] = {0, 0, 0, 0};
+        const Card* boardCards = boards + board * 5;
+        for (int i = 0; i < 5; ++i) {
+            addCardToMasks(boardMasks, boardCards[i]);
+        }
+
+        HandValue* out = results + board * numPlayers;
+        for (int player = 0; player < numPlayers; ++player) {
+            std::uint16_t suitMasks[4] = {
+                static_cast<std::uint16_t>(boardMasks[0] | holeMasks[player][0]),
+                static_cast<std::uint16_t>(boardMasks[1] | holeMasks[player][1]),
+                static_cast<std::uint16_t>(boardMasks[2] | holeMasks[player][2]),
+                static_cast<std::uint16_t>(boardMasks[3] | holeMasks[player][3])};
+            out[player] = evaluateSeven(suitMasks);
+        }
+    }
+}
+
 int PokerEvaluator::compareHands(const HandScore& score1, const HandScore& score2) {
     for (std::size_t i = 0; i < std::min(score1.size(), score2.size()); ++i) {
         if (score1[i] > score2[i]) return 1;
@@ -3,9 +3,16 @@
 #include <string>
 #include <chrono>
 #include <iomanip>
+#include <array>
+#include <vector>
 
+#include "aof/equity_engine.hpp"
 #include "aof/game.hpp"
 #include "aof/game_config.hpp"
+#include "mccfr/best_response.hpp"
+#include "mccfr/strategy_manager.hpp"
+#include "mccfr/sweep.hpp"
+#include "mccfr/telemetry_log.hpp"
 #include "mccfr/trainer.hpp"
 
 /**
@@ -19,8 +26,38 @@ void printUsage(const char* programName) {
     std::cout << "  -s, --small-blind <amount> Small blind amount (default: 0.4)\n";
     std::cout << "  -b, --big-blind <amount>   Big blind amount (default: 1.0)\n";
     std::cout << "  -o, --output <prefix>      Output file prefix (default: strategy)\n";
+    std::cout << "  -t, --threads <num>        Worker threads for training (default: 1)\n";
+    std::cout << "  --batch-size <num>         Deals dealt and traversed together per batch (default: 1)\n";
+    std::cout << "  --memory-budget <MB>       Spill cold nodes to disk when the node map grows past this (default: off)\n";
+    std::cout << "  --sampling <scheme>        MCCFR sampling scheme: external or outcome (default: external)\n";
+    std::cout << "  --update-rule <rule>       Regret update rule: vanilla, cfr+ or dcfr (default: vanilla)\n";
+    std::cout << "  --prune                    Skip branches with deeply negative regret (external sampling)\n";
+    std::cout << "  --prune-threshold <regret> Regret below which a branch is skipped (default: -300)\n";
+    std::cout << "  --seed <num>               Master RNG seed for reproducible runs (default: random)\n";
+    std::cout << "  --terminal-eval <mode>     Terminal evaluation: sampled or expected (default: sampled)\n";
+    std::cout << "  --equity-table <file>      Equity table loaded at startup and saved on exit (expected mode)\n";
+    std::cout << "  --equity <cards>           Print Monte Carlo all-in equities for 2-4 hole card pairs and exit\n";
+    std::cout << "                            (e.g. \"AsAh 7c2d\"; deterministic for a given --seed)\n";
+    std::cout << "  --equity-boards <num>      Boards sampled by --equity (default: 200000)\n";
+    std::cout << "  --exploit-interval <num>   Evaluate exploitability every N iterations (default: off)\n";
+    std::cout << "  --exploit-stop <amount>    Stop when exploitability drops below this, in chips/hand\n";
+    std::cout << "  --evaluate <file>          Evaluate a saved strategy file and exit (no training)\n";
+    std::cout << "  --eval-deals <num>         Deals sampled per exploitability estimate (default: 20000)\n";
+    std::cout << "  --checkpoint-interval <num> Write checkpoints every N iterations (default: off)\n";
+    std::cout << "  --resume <file>            Continue training from a <prefix>_resume.ckpt checkpoint\n";
+    std::cout << "  --warm-start <file>        Seed new nodes from a related configuration's strategy file\n";
+    std::cout << "  --warm-start-weight <num>  Strategy-sum mass given to the warm-start prior (default: 1000)\n";
+    std::cout << "  --sweep <file>             Train every configuration in a sweep file across -t workers\n";
+    std::cout << "  --sync-dir <dir>           Shared directory for distributed regret exchange\n";
+    std::cout << "  --worker-id <id>           This worker's id in a distributed run (default: 0)\n";
+    std::cout << "  --sync-interval <num>      Iterations between delta exchanges (default: 100000)\n";
     std::cout << "  -q, --quiet               Suppress progress output\n";
     std::cout << "  --realtime                Enable real-time visualization mode\n";
+    std::cout << "  --shm-ring <file>         Stream data points into a shared-memory ring file\n";
+    std::cout << "                            (read live with: visualizer.py --live <file>)\n";
+    std::cout << "  --telemetry-log <file>    Append binary telemetry records to a rotated on-disk log\n";
+    std::cout << "  --telemetry-max-mb <num>  Telemetry segment size that triggers rotation (default: 64)\n";
+    std::cout << "  --telemetry-to-csv <file> Convert a telemetry log to <file>.csv and exit\n";
     std::cout << "  --log-interval <num>      Data logging interval (default: 10)\n";
     std::cout << "  -h, --help                Show this help message\n\n";
     std::cout << "EXAMPLES:\n";
@@ -28,6 +65,7 @@ void printUsage(const char* programName) {
     std::cout << "  " << programName << " -i 5000000         # Train for 5M iterations\n";
     std::cout << "  " << programName << " -s 0.1 -b 0.2      # Use 10c/20c stakes\n";
     std::cout << "  " << programName << " -o my_strategy -q  # Custom output, quiet mode\n";
+    std::cout << "  " << programName << " --evaluate strategy_2026_01_01_00_00_00.txt\n";
 }
 
 /**
@@ -38,9 +76,37 @@ struct Config {
     double smallBlind = 0.4;
     double bigBlind = 1.0;
     std::string outputPrefix = "strategy";
+    int numThreads = 1;
+    int batchSize = 1;
+    int memoryBudgetMB = 0;
+    std::string samplingScheme = "external";
+    std::string updateRule = "vanilla";
+    bool enablePruning = false;
+    double pruneThreshold = -300.0;
+    std::uint64_t rngSeed = 0;
+    std::string terminalEval = "sampled";
+    std::string equityTableFile;
+    std::string equityCards;
+    int equityBoards = 200000;
+    int exploitInterval = 0;
+    double exploitStop = 0.0;
+    std::string evaluateFile;
+    int evalDeals = 20000;
+    int checkpointInterval = 0;
+    std::string resumeFile;
+    std::string warmStartFile;
+    double warmStartWeight = 1000.0;
+    std::string sweepFile;
+    std::string syncDirectory;
+    int syncWorkerId = 0;
+    int syncInterval = 100000;
     bool quiet = false;
     bool showHelp = false;
     bool enableRealtime = false;
+    std::string shmRingFile;
+    std::string telemetryLogFile;
+    int telemetryMaxMB = 64;
+    std::string telemetryConvertFile;
     int logInterval = 10;
 };
 
@@ -63,8 +129,64 @@ Config parseArguments(int argc, char* argv[]) {
             config.bigBlind = std::stod(argv[++i]);
         } else if ((arg == "-o" || arg == "--output") && i + 1 < argc) {
             config.outputPrefix = argv[++i];
+        } else if ((arg == "-t" || arg == "--threads") && i + 1 < argc) {
+            config.numThreads = std::stoi(argv[++i]);
+        } else if (arg == "--batch-size" && i + 1 < argc) {
+            config.batchSize = std::stoi(argv[++i]);
+        } else if (arg == "--memory-budget" && i + 1 < argc) {
+            config.memoryBudgetMB = std::stoi(argv[++i]);
+        } else if (arg == "--sampling" && i + 1 < argc) {
+            config.samplingScheme = argv[++i];
+        } else if (arg == "--update-rule" && i + 1 < argc) {
+            config.updateRule = argv[++i];
+        } else if (arg == "--prune") {
+            config.enablePruning = true;
+        } else if (arg == "--prune-threshold" && i + 1 < argc) {
+            config.pruneThreshold = std::stod(argv[++i]);
+        } else if (arg == "--seed" && i + 1 < argc) {
+            config.rngSeed = std::stoull(argv[++i]);
+        } else if (arg == "--terminal-eval" && i + 1 < argc) {
+            config.terminalEval = argv[++i];
+        } else if (arg == "--equity-table" && i + 1 < argc) {
+            config.equityTableFile = argv[++i];
+        } else if (arg == "--equity" && i + 1 < argc) {
+            config.equityCards = argv[++i];
+        } else if (arg == "--equity-boards" && i + 1 < argc) {
+            config.equityBoards = std::stoi(argv[++i]);
+        } else if (arg == "--exploit-interval" && i + 1 < argc) {
+            config.exploitInterval = std::stoi(argv[++i]);
+        } else if (arg == "--exploit-stop" && i + 1 < argc) {
+            config.exploitStop = std::stod(argv[++i]);
+        } else if (arg == "--evaluate" && i + 1 < argc) {
+            config.evaluateFile = argv[++i];
+        } else if (arg == "--eval-deals" && i + 1 < argc) {
+            config.evalDeals = std::stoi(argv[++i]);
+        } else if (arg == "--checkpoint-interval" && i + 1 < argc) {
+            config.checkpointInterval = std::stoi(argv[++i]);
+        } else if (arg == "--resume" && i + 1 < argc) {
+            config.resumeFile = argv[++i];
+        } else if (arg == "--warm-start" && i + 1 < argc) {
+            config.warmStartFile = argv[++i];
+        } else if (arg == "--warm-start-weight" && i + 1 < argc) {
+            config.warmStartWeight = std::stod(argv[++i]);
+        } else if (arg == "--sweep" && i + 1 < argc) {
+            config.sweepFile = argv[++i];
+        } else if (arg == "--sync-dir" && i + 1 < argc) {
+            config.syncDirectory = argv[++i];
+        } else if (arg == "--worker-id" && i + 1 < argc) {
+            config.syncWorkerId = std::stoi(argv[++i]);
+        } else if (arg == "--sync-interval" && i + 1 < argc) {
+            config.syncInterval = std::stoi(argv[++i]);
         } else if (arg == "--realtime") {
             config.enableRealtime = true;
+        } else if (arg == "--shm-ring" && i + 1 < argc) {
+            config.shmRingFile = argv[++i];
+        } else if (arg == "--telemetry-log" && i + 1 < argc) {
+            config.telemetryLogFile = argv[++i];
+        } else if (arg == "--telemetry-max-mb" && i + 1 < argc) {
+            config.telemetryMaxMB = std::stoi(argv[++i]);
+        } else if (arg == "--telemetry-to-csv" && i + 1 < argc) {
+            config.telemetryConvertFile = argv[++i];
         } else if (arg == "--log-interval" && i + 1 < argc) {
             config.logInterval = std::stoi(argv[++i]);
         } else {
@@ -94,6 +216,131 @@ void validateConfig(const Config& config) {
     if (config.outputPrefix.empty()) {
         throw std::invalid_argument("Output prefix cannot be empty");
     }
+
+    if (config.numThreads <= 0) {
+        throw std::invalid_argument("Thread count must be positive");
+    }
+
+    if (config.batchSize <= 0) {
+        throw std::invalid_argument("Batch size must be positive");
+    }
+
+    if (config.memoryBudgetMB < 0) {
+        throw std::invalid_argument("Memory budget must be non-negative");
+    }
+
+    if (config.memoryBudgetMB > 0) {
+        if (config.numThreads > 1) {
+            throw std::invalid_argument(
+                "Memory budget requires single-threaded training (spilling "
+                "rehashes the node map under the workers)");
+        }
+        if (config.checkpointInterval > 0) {
+            throw std::invalid_argument(
+                "Memory budget cannot be combined with --checkpoint-interval; "
+                "checkpoints would miss the spilled nodes");
+        }
+        if (!config.syncDirectory.empty()) {
+            throw std::invalid_argument(
+                "Memory budget cannot be combined with --sync-dir; regret "
+                "deltas would miss the spilled nodes");
+        }
+        if (!config.warmStartFile.empty()) {
+            throw std::invalid_argument(
+                "Memory budget cannot be combined with --warm-start; a "
+                "spilled node recreated by training would be seeded again "
+                "on top of the seeding already in the spill file");
+        }
+    }
+
+    if (config.samplingScheme != "external" && config.samplingScheme != "outcome") {
+        throw std::invalid_argument("Sampling scheme must be 'external' or 'outcome'");
+    }
+
+    if (config.updateRule != "vanilla" && config.updateRule != "cfr+" &&
+        config.updateRule != "dcfr") {
+        throw std::invalid_argument("Update rule must be 'vanilla', 'cfr+' or 'dcfr'");
+    }
+
+    if (config.enablePruning && config.samplingScheme != "external") {
+        throw std::invalid_argument(
+            "Pruning requires external sampling (outcome sampling already "
+            "descends a single action per node)");
+    }
+
+    if (config.pruneThreshold >= 0.0) {
+        throw std::invalid_argument("Pruning threshold must be negative");
+    }
+
+    if (config.terminalEval != "sampled" && config.terminalEval != "expected") {
+        throw std::invalid_argument("Terminal evaluation must be 'sampled' or 'expected'");
+    }
+
+    if (config.equityBoards <= 0) {
+        throw std::invalid_argument("Equity board count must be positive");
+    }
+
+    if (!config.equityCards.empty() &&
+        (!config.sweepFile.empty() || !config.evaluateFile.empty())) {
+        throw std::invalid_argument("--equity is a standalone query and cannot be combined with --sweep or --evaluate");
+    }
+
+    if (config.exploitInterval < 0) {
+        throw std::invalid_argument("Exploitability interval must be non-negative");
+    }
+
+    if (config.exploitStop < 0) {
+        throw std::invalid_argument("Exploitability stop threshold must be non-negative");
+    }
+
+    if (config.evalDeals <= 0) {
+        throw std::invalid_argument("Evaluation deal count must be positive");
+    }
+
+    if (config.checkpointInterval < 0) {
+        throw std::invalid_argument("Checkpoint interval must be non-negative");
+    }
+
+    if (config.warmStartWeight <= 0.0) {
+        throw std::invalid_argument("Warm-start weight must be positive");
+    }
+
+    if (!config.warmStartFile.empty() && !config.resumeFile.empty()) {
+        throw std::invalid_argument("Warm start cannot be combined with --resume; the checkpoint already carries its own sums");
+    }
+
+    if (!config.resumeFile.empty() && !config.syncDirectory.empty()) {
+        throw std::invalid_argument("Resuming a distributed worker is not supported; the sync baseline would double-count the restored sums");
+    }
+
+    if (!config.sweepFile.empty() &&
+        (!config.resumeFile.empty() || !config.evaluateFile.empty() ||
+         !config.syncDirectory.empty() || !config.warmStartFile.empty() ||
+         !config.telemetryLogFile.empty())) {
+        throw std::invalid_argument("Sweep mode cannot be combined with --resume, --evaluate, --sync-dir, --warm-start or --telemetry-log");
+    }
+
+    if (config.telemetryMaxMB <= 0) {
+        throw std::invalid_argument("Telemetry segment size must be positive");
+    }
+
+    if (!config.telemetryLogFile.empty() && config.numThreads > 1) {
+        throw std::invalid_argument(
+            "Telemetry logging records the single-threaded training loop "
+            "and cannot be combined with -t > 1");
+    }
+
+    if (!config.syncDirectory.empty()) {
+        if (config.syncWorkerId < 0) {
+            throw std::invalid_argument("Worker id must be non-negative");
+        }
+        if (config.syncInterval <= 0) {
+            throw std::invalid_argument("Sync interval must be positive");
+        }
+        if (config.numThreads > 1) {
+            throw std::invalid_argument("Distributed workers run single-threaded; start more processes instead");
+        }
+    }
 }
 
 /**
@@ -111,6 +358,46 @@ void printConfig(const Config& config) {
     std::cout << "================================\n\n";
 }
 
+/**
+ * @brief Parse a card list like "AsAh 7c2d" into Card objects
+ *
+ * Cards are two characters ("Kd") except for tens, which use the same
+ * two-character rank as the rest of the codebase ("10s"). Spaces and
+ * commas between cards are ignored.
+ * @throws std::invalid_argument on malformed input
+ */
+std::vector<aof::Card> parseCardList(const std::string& text) {
+    std::vector<aof::Card> cards;
+
+    std::size_t pos = 0;
+    while (pos < text.size()) {
+        if (text[pos] == ' ' || text[pos] == ',') {
+            ++pos;
+            continue;
+        }
+
+        std::string rank(1, text[pos]);
+        if (rank == "1") {
+            // "10" is the only two-character rank
+            if (pos + 1 >= text.size() || text[pos + 1] != '0') {
+                throw std::invalid_argument("Invalid card rank in: " + text);
+            }
+            rank = "10";
+            ++pos;
+        }
+        ++pos;
+
+        if (pos >= text.size()) {
+            throw std::invalid_argument("Card missing its suit in: " + text);
+        }
+        std::string suit(1, text[pos]);
+        ++pos;
+
+        cards.emplace_back(rank, suit);  // Throws on unknown rank or suit
+    }
+    return cards;
+}
+
 int main(int argc, char* argv[]) {
     try {
         // Parse command line arguments
@@ -123,10 +410,122 @@ int main(int argc, char* argv[]) {
         
         validateConfig(config);
         
-        if (!config.quiet) {
+        if (!config.quiet && config.evaluateFile.empty() &&
+            config.sweepFile.empty() && config.equityCards.empty() &&
+            config.telemetryConvertFile.empty()) {
             printConfig(config);
         }
-        
+
+        // Standalone telemetry conversion: export a binary log segment to
+        // CSV for visualizer.py and the plotting scripts, then exit
+        if (!config.telemetryConvertFile.empty()) {
+            std::string csvFile = config.telemetryConvertFile + ".csv";
+            if (!mccfr::telemetry_log::exportCsv(config.telemetryConvertFile,
+                                                 csvFile)) {
+                throw std::runtime_error("Failed to convert telemetry log: " +
+                                         config.telemetryConvertFile);
+            }
+            std::cout << "Telemetry exported to " << csvFile << "\n";
+            return 0;
+        }
+
+        // Standalone equity query: estimate all-in equities for a concrete
+        // lineup by bulk board sampling and exit without training
+        if (!config.equityCards.empty()) {
+            auto cards = parseCardList(config.equityCards);
+            if (cards.size() % 2 != 0 || cards.size() < 4 ||
+                cards.size() > 2 * aof::GameConfig::NUM_PLAYERS) {
+                throw std::invalid_argument(
+                    "--equity needs 2-4 hole card pairs (e.g. \"AsAh 7c2d\")");
+            }
+            int numContenders = static_cast<int>(cards.size()) / 2;
+
+            aof::EquityEngine engine;
+            std::array<double, aof::GameConfig::NUM_PLAYERS> equities{};
+
+            auto start = std::chrono::steady_clock::now();
+            engine.estimateEquities(cards.data(), numContenders,
+                                    config.equityBoards, config.rngSeed,
+                                    equities.data());
+            auto elapsed = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - start).count();
+
+            std::cout << "All-in equities over " << config.equityBoards
+                      << " sampled boards:\n";
+            std::cout << std::fixed << std::setprecision(2);
+            for (int i = 0; i < numContenders; ++i) {
+                std::cout << "  " << cards[i * 2].toString()
+                          << cards[i * 2 + 1].toString() << ": "
+                          << std::setw(6) << equities[i] * 100.0 << "%\n";
+            }
+            if (!config.quiet && elapsed > 0.0) {
+                std::cout << "\n" << std::setprecision(1)
+                          << (config.equityBoards / elapsed / 1e6)
+                          << "M boards/s\n";
+            }
+            return 0;
+        }
+
+        // Sweep mode: train every configuration in the file across a
+        // worker pool and exit; each entry carries its own blinds, stacks
+        // and iteration count, so the single-config options below do not apply
+        if (!config.sweepFile.empty()) {
+            auto entries = mccfr::SweepRunner::loadSweepFile(config.sweepFile);
+
+            mccfr::SweepRunner::Options options;
+            options.numWorkers = config.numThreads;
+            options.outputPrefix = config.outputPrefix;
+            options.rngSeed = config.rngSeed;
+            options.samplingScheme = (config.samplingScheme == "outcome")
+                ? mccfr::SamplingScheme::OUTCOME
+                : mccfr::SamplingScheme::EXTERNAL;
+            if (config.updateRule == "cfr+") {
+                options.updateRule = mccfr::UpdateRule::CFR_PLUS;
+            } else if (config.updateRule == "dcfr") {
+                options.updateRule = mccfr::UpdateRule::DISCOUNTED;
+            }
+            options.enableProgressOutput = !config.quiet;
+
+            // One thread-safe equity engine serves every configuration, so
+            // the estimation cost of a bucket matchup is paid once per sweep
+            std::shared_ptr<aof::EquityEngine> sweepEquityEngine;
+            if (config.terminalEval == "expected") {
+                sweepEquityEngine = std::make_shared<aof::EquityEngine>();
+                if (!config.equityTableFile.empty() &&
+                    sweepEquityEngine->loadTable(config.equityTableFile) &&
+                    !config.quiet) {
+                    std::cout << "Loaded " << sweepEquityEngine->tableSize()
+                              << " equity table entries from "
+                              << config.equityTableFile << "\n\n";
+                }
+                options.equityEngine = sweepEquityEngine;
+            }
+
+            if (!config.quiet) {
+                std::cout << "Sweeping " << entries.size()
+                          << " configurations on " << config.numThreads
+                          << " workers...\n\n";
+            }
+
+            mccfr::SweepRunner runner;
+            auto results = runner.run(entries, options);
+
+            if (sweepEquityEngine && !config.equityTableFile.empty() &&
+                sweepEquityEngine->saveTable(config.equityTableFile) &&
+                !config.quiet) {
+                std::cout << "Saved " << sweepEquityEngine->tableSize()
+                          << " equity table entries to "
+                          << config.equityTableFile << "\n";
+            }
+
+            for (const auto& result : results) {
+                if (!result.succeeded) {
+                    return 1;
+                }
+            }
+            return 0;
+        }
+
         // Create game with specified parameters
         aof::Stakes stakes{config.smallBlind, config.bigBlind};
         aof::GameParameters gameParams;
@@ -149,13 +548,85 @@ int main(int argc, char* argv[]) {
         }
         
         aof::Game game(config.smallBlind, config.bigBlind, gameParams);
-        
+
+        // Standalone evaluation mode: measure a saved strategy file's
+        // exploitability and exit without training
+        if (!config.evaluateFile.empty()) {
+            mccfr::StrategyManager manager;
+            if (!manager.loadFromBinary(config.evaluateFile) &&
+                !manager.loadFromFile(config.evaluateFile)) {
+                throw std::runtime_error("Failed to load strategy file: " +
+                                         config.evaluateFile);
+            }
+
+            mccfr::BestResponseEvaluator evaluator(game);
+            evaluator.loadFromStrategyManager(manager);
+            if (evaluator.size() == 0) {
+                throw std::runtime_error("No usable strategies in file: " +
+                                         config.evaluateFile);
+            }
+
+            std::cout << "Evaluating " << evaluator.size() << " strategies from "
+                      << config.evaluateFile << " over " << config.evalDeals
+                      << " deals...\n\n";
+
+            auto result = evaluator.evaluate(config.evalDeals, config.numThreads);
+
+            std::cout << std::fixed << std::setprecision(6);
+            for (int player = 0; player < aof::GameConfig::NUM_PLAYERS; ++player) {
+                std::cout << "  Player " << player
+                          << ": profile " << std::setw(10) << result.profileValues[player]
+                          << "  best response " << std::setw(10)
+                          << result.bestResponseValues[player]
+                          << "  gain " << std::setw(10)
+                          << (result.bestResponseValues[player] - result.profileValues[player])
+                          << "\n";
+            }
+            std::cout << "\nExploitability: " << result.exploitability
+                      << " chips/hand\n";
+            return 0;
+        }
+
+        // Optional expected-value terminal evaluation from equity tables
+        std::shared_ptr<aof::EquityEngine> equityEngine;
+        if (config.terminalEval == "expected") {
+            equityEngine = std::make_shared<aof::EquityEngine>();
+            if (!config.equityTableFile.empty() &&
+                equityEngine->loadTable(config.equityTableFile) && !config.quiet) {
+                std::cout << "Loaded " << equityEngine->tableSize()
+                          << " equity table entries from " << config.equityTableFile << "\n\n";
+            }
+            game.setEquityEngine(equityEngine);
+        }
+
         // Create trainer
         mccfr::Trainer trainer(game);
         
         // Configure training
         mccfr::TrainingConfig trainingConfig;
         trainingConfig.iterations = config.iterations;
+        trainingConfig.numThreads = config.numThreads;
+        trainingConfig.batchSize = config.batchSize;
+        trainingConfig.memoryBudgetBytes =
+            static_cast<std::size_t>(config.memoryBudgetMB) * 1024 * 1024;
+        trainingConfig.samplingScheme = (config.samplingScheme == "outcome")
+            ? mccfr::SamplingScheme::OUTCOME
+            : mccfr::SamplingScheme::EXTERNAL;
+        trainingConfig.rngSeed = config.rngSeed;
+        if (config.updateRule == "cfr+") {
+            trainingConfig.updateRule = mccfr::UpdateRule::CFR_PLUS;
+        } else if (config.updateRule == "dcfr") {
+            trainingConfig.updateRule = mccfr::UpdateRule::DISCOUNTED;
+        }
+        trainingConfig.enablePruning = config.enablePruning;
+        trainingConfig.pruningThreshold = config.pruneThreshold;
+        trainingConfig.exploitabilityInterval = config.exploitInterval;
+        trainingConfig.exploitabilityDeals = config.evalDeals;
+        trainingConfig.exploitabilityThreshold = config.exploitStop;
+        trainingConfig.checkpointInterval = config.checkpointInterval;
+        trainingConfig.syncDirectory = config.syncDirectory;
+        trainingConfig.syncWorkerId = config.syncWorkerId;
+        trainingConfig.syncInterval = config.syncInterval;
         trainingConfig.enableProgressOutput = !config.quiet;
         trainingConfig.outputPrefix = config.outputPrefix;
         trainingConfig.progressUpdateInterval = std::max(1, config.iterations / 100);
@@ -165,16 +636,28 @@ int main(int argc, char* argv[]) {
         trainingConfig.utilityUpdateInterval = std::max(1, config.iterations / 20); // More frequent utility updates
         trainingConfig.showUtilityVariance = true;
         
-        // Configure real-time visualization (no CSV logging)
-        trainingConfig.enableDataLogging = false;  // Disabled - using web-based visualization only
-        
-        // Configure direct real-time visualization (no intermediate files)
-        trainingConfig.realtimeConfig.enabled = config.enableRealtime;
+        // Durable binary telemetry log (rotated; convert with --telemetry-to-csv)
+        if (!config.telemetryLogFile.empty()) {
+            trainingConfig.enableDataLogging = true;
+            trainingConfig.dataLogFile = config.telemetryLogFile;
+            trainingConfig.dataLogInterval = config.logInterval;
+            trainingConfig.dataLogMaxBytes =
+                static_cast<std::size_t>(config.telemetryMaxMB) * 1024 * 1024;
+        }
+
+
+        // Configure direct real-time visualization (no intermediate files).
+        // The shared-memory ring rides on the same data-point stream, so
+        // --shm-ring alone enables the visualizer but not the web server
+        trainingConfig.realtimeConfig.enabled =
+            config.enableRealtime || !config.shmRingFile.empty();
+        trainingConfig.realtimeConfig.enableWebServer = config.enableRealtime;
+        trainingConfig.realtimeConfig.sharedMemoryFile = config.shmRingFile;
         trainingConfig.realtimeConfig.updateInterval = std::max(1, std::min(config.logInterval, 5));
         trainingConfig.realtimeConfig.maxDataPoints = 2000;
-        trainingConfig.realtimeConfig.showConsoleStats = !config.quiet;
+        trainingConfig.realtimeConfig.showConsoleStats = !config.quiet && config.enableRealtime;
         trainingConfig.realtimeConfig.windowTitle = "MCCFR Training Progress";
-        
+
         if (config.enableRealtime) {
             // Optimize for real-time visualization
             trainingConfig.enableUtilityTracking = false; // Reduce console spam
@@ -184,10 +667,36 @@ int main(int argc, char* argv[]) {
             }
         }
         
+        // Continue a checkpointed run exactly where it stopped;
+        // --iterations stays the total for the whole run
+        if (!config.resumeFile.empty()) {
+            if (!trainer.loadCheckpoint(config.resumeFile)) {
+                throw std::runtime_error("Failed to load checkpoint: " +
+                                         config.resumeFile);
+            }
+        }
+
+        // Seed new nodes from a related configuration's strategies
+        if (!config.warmStartFile.empty()) {
+            if (!trainer.warmStart(config.warmStartFile, config.warmStartWeight)) {
+                throw std::runtime_error("Failed to warm-start from: " +
+                                         config.warmStartFile);
+            }
+        }
+
         // Train the model
         auto startTime = std::chrono::steady_clock::now();
         auto finalUtilities = trainer.train(trainingConfig);
         auto endTime = std::chrono::steady_clock::now();
+
+        // Persist equities discovered during the run so the next run
+        // starts with a warm table
+        if (equityEngine && !config.equityTableFile.empty()) {
+            if (equityEngine->saveTable(config.equityTableFile) && !config.quiet) {
+                std::cout << "Saved " << equityEngine->tableSize()
+                          << " equity table entries to " << config.equityTableFile << "\n";
+            }
+        }
         
         if (!config.quiet) {
             auto duration = std::chrono::duration_cast<std::chrono::seconds>(endTime - startTime);
@@ -0,0 +1,232 @@
+#include "mccfr/best_response.hpp"
+#include "mccfr/utils.hpp"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace mccfr {
+
+BestResponseEvaluator::BestResponseEvaluator(const aof::Game& game)
+    : game_(game) {
+}
+
+void BestResponseEvaluator::loadFromNodeMap(const FlatNodeMap& nodeMap) {
+    strategies_.clear();
+    strategies_.reserve(nodeMap.size());
+
+    nodeMap.forEach([this](InfoSetKey key, const Node& node) {
+        Strategy strategy{};
+        node.getAverageStrategy(strategy.data());
+        strategies_[key] = strategy;
+    });
+}
+
+void BestResponseEvaluator::loadFromStrategyManager(const StrategyManager& manager) {
+    strategies_.clear();
+    strategies_.reserve(manager.size());
+
+    for (const auto& [infoSet, probabilities] : manager.getAllStrategies()) {
+        InfoSetKey key = 0;
+        if (probabilities.empty() ||
+            probabilities.size() > static_cast<std::size_t>(Node::MAX_ACTIONS) ||
+            !utils::parseInfoSetString(infoSet, key)) {
+            continue;
+        }
+
+        Strategy strategy{};
+        std::copy(probabilities.begin(), probabilities.end(), strategy.begin());
+        strategies_[key] = strategy;
+    }
+}
+
+ExploitabilityResult BestResponseEvaluator::evaluate(int numDeals,
+                                                     int numThreads,
+                                                     std::uint64_t seed) const {
+    numDeals = std::max(1, numDeals);
+    numThreads = std::max(1, numThreads);
+
+    // Per-thread partial results, merged below. Accumulators must be
+    // merged before maximizing: the best response maximizes the summed
+    // action values per information set, not per deal.
+    struct Partial {
+        std::array<Accumulator, aof::GameConfig::NUM_PLAYERS> accumulators;
+        std::array<double, aof::GameConfig::NUM_PLAYERS> baselines{};
+        std::array<double, aof::GameConfig::NUM_PLAYERS> profileTotals{};
+    };
+    std::vector<Partial> partials(numThreads);
+
+    auto worker = [&](int threadIndex) {
+        Partial& partial = partials[threadIndex];
+
+        for (int deal = threadIndex; deal < numDeals; deal += numThreads) {
+            // One deterministic seed per deal keeps the estimate
+            // independent of the thread count
+            aof::FastRng dealSeed(seed + static_cast<std::uint64_t>(deal));
+            auto state = game_.createInitialState(dealSeed.next());
+            state->applyAction(aof::Action::DEAL);
+
+            for (int player = 0; player < aof::GameConfig::NUM_PLAYERS; ++player) {
+                partial.profileTotals[player] += profileValue(*state, player);
+                accumulateBestResponse(*state, player, 1.0,
+                                       partial.accumulators[player],
+                                       partial.baselines[player]);
+            }
+        }
+    };
+
+    if (numThreads == 1) {
+        worker(0);
+    } else {
+        std::vector<std::thread> threads;
+        threads.reserve(numThreads);
+        for (int t = 0; t < numThreads; ++t) {
+            threads.emplace_back(worker, t);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    ExploitabilityResult result;
+    result.numDeals = numDeals;
+
+    for (int player = 0; player < aof::GameConfig::NUM_PLAYERS; ++player) {
+        Accumulator merged;
+        double baseline = 0.0;
+        double profileTotal = 0.0;
+
+        for (const Partial& partial : partials) {
+            baseline += partial.baselines[player];
+            profileTotal += partial.profileTotals[player];
+            for (const auto& [key, values] : partial.accumulators[player]) {
+                ActionValues& target = merged[key];
+                for (int a = 0; a < Node::MAX_ACTIONS; ++a) {
+                    target.value[a] += values.value[a];
+                }
+            }
+        }
+
+        double bestResponseTotal = baseline;
+        for (const auto& [key, values] : merged) {
+            bestResponseTotal +=
+                *std::max_element(values.value.begin(), values.value.end());
+        }
+
+        result.bestResponseValues[player] = bestResponseTotal / numDeals;
+        result.profileValues[player] = profileTotal / numDeals;
+        result.exploitability +=
+            (result.bestResponseValues[player] - result.profileValues[player]);
+    }
+    result.exploitability /= aof::GameConfig::NUM_PLAYERS;
+
+    return result;
+}
+
+void BestResponseEvaluator::profileStrategy(const aof::GameState& state,
+                                            int player,
+                                            double* strategy) const {
+    InfoSetKey key = utils::encodeInfoSet(state, player);
+    auto it = strategies_.find(key);
+    if (it != strategies_.end()) {
+        for (int a = 0; a < Node::MAX_ACTIONS; ++a) {
+            strategy[a] = it->second[a];
+        }
+        return;
+    }
+
+    // Untrained information sets play uniformly, like regret matching
+    // does before any regret accumulates
+    for (int a = 0; a < Node::MAX_ACTIONS; ++a) {
+        strategy[a] = 0.5;
+    }
+}
+
+double BestResponseEvaluator::profileValue(aof::GameState& state,
+                                           int forPlayer) const {
+    if (state.isTerminal()) {
+        return state.getReturns()[forPlayer];
+    }
+
+    if (state.isChanceNode()) {
+        aof::GameState::UndoToken undo;
+        state.applyAction(aof::Action::DEAL, undo);
+        double value = profileValue(state, forPlayer);
+        state.undoAction(undo);
+        return value;
+    }
+
+    int player = state.getCurrentPlayer();
+    auto legalActions = state.getLegalActions();
+
+    Strategy strategy{};
+    profileStrategy(state, player, strategy.data());
+
+    double value = 0.0;
+    for (std::size_t a = 0; a < legalActions.size(); ++a) {
+        if (strategy[a] <= 0.0) {
+            continue;
+        }
+
+        aof::GameState::UndoToken undo;
+        state.applyAction(legalActions[a], undo);
+        value += strategy[a] * profileValue(state, forPlayer);
+        state.undoAction(undo);
+    }
+    return value;
+}
+
+void BestResponseEvaluator::accumulateBestResponse(aof::GameState& state,
+                                                   int forPlayer,
+                                                   double oppReach,
+                                                   Accumulator& accumulator,
+                                                   double& baseline) const {
+    if (state.isTerminal()) {
+        // The deviator never got to act on this path; its utility is
+        // fixed by the opponents' play
+        baseline += oppReach * state.getReturns()[forPlayer];
+        return;
+    }
+
+    if (state.isChanceNode()) {
+        aof::GameState::UndoToken undo;
+        state.applyAction(aof::Action::DEAL, undo);
+        accumulateBestResponse(state, forPlayer, oppReach, accumulator, baseline);
+        state.undoAction(undo);
+        return;
+    }
+
+    int player = state.getCurrentPlayer();
+    auto legalActions = state.getLegalActions();
+
+    if (player == forPlayer) {
+        // Each player acts at most once, so the continuation after any
+        // action is a pure profile expectation
+        InfoSetKey key = utils::encodeInfoSet(state, player);
+        ActionValues& values = accumulator[key];
+
+        for (std::size_t a = 0; a < legalActions.size(); ++a) {
+            aof::GameState::UndoToken undo;
+            state.applyAction(legalActions[a], undo);
+            values.value[a] += oppReach * profileValue(state, forPlayer);
+            state.undoAction(undo);
+        }
+        return;
+    }
+
+    Strategy strategy{};
+    profileStrategy(state, player, strategy.data());
+
+    for (std::size_t a = 0; a < legalActions.size(); ++a) {
+        if (strategy[a] <= 0.0) {
+            continue;
+        }
+
+        aof::GameState::UndoToken undo;
+        state.applyAction(legalActions[a], undo);
+        accumulateBestResponse(state, forPlayer, oppReach * strategy[a],
+                               accumulator, baseline);
+        state.undoAction(undo);
+    }
+}
+
+} // namespace mccfr
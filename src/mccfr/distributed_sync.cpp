@@ -0,0 +1,207 @@
+#include "mccfr/distributed_sync.hpp"
+#include "mccfr/strategy_file_format.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace mccfr {
+
+namespace {
+
+/// One node's published sums, staged before the file write
+struct DeltaEntry {
+    InfoSetKey key;
+    std::uint64_t visitDelta;
+    std::array<double, Node::MAX_ACTIONS> regretDelta;
+    std::array<double, Node::MAX_ACTIONS> strategyDelta;
+};
+
+} // namespace
+
+DistributedSync::DistributedSync(const std::string& syncDirectory, int workerId)
+    : syncDirectory_(syncDirectory)
+    , workerId_(workerId)
+{
+    std::filesystem::create_directories(syncDirectory_);
+}
+
+std::string DistributedSync::deltaPath(int workerId, int epoch) const {
+    return syncDirectory_ + "/regrets_w" + std::to_string(workerId) +
+           "_e" + std::to_string(epoch) + ".bin";
+}
+
+std::size_t DistributedSync::publishDelta(const FlatNodeMap& current) {
+    std::string finalPath = deltaPath(workerId_, epoch_);
+    std::string tempPath = finalPath + ".tmp";
+
+    std::size_t published = writeDeltaFile(tempPath, current);
+    if (std::rename(tempPath.c_str(), finalPath.c_str()) != 0) {
+        std::remove(tempPath.c_str());
+        std::cerr << "Warning: could not publish delta file " << finalPath << std::endl;
+        return 0;
+    }
+
+    // The published sums are now accounted for
+    baseline_ = current;
+
+    // Prune this worker's files beyond the retention window
+    int staleEpoch = epoch_ - EPOCH_RETENTION;
+    if (staleEpoch >= 0) {
+        std::remove(deltaPath(workerId_, staleEpoch).c_str());
+    }
+
+    ++epoch_;
+    return published;
+}
+
+std::size_t DistributedSync::writeDeltaFile(const std::string& path,
+                                            const FlatNodeMap& current) const {
+    std::vector<DeltaEntry> entries;
+    entries.reserve(current.size());
+
+    std::uint32_t numActions = 0;
+    current.forEach([&](InfoSetKey key, const Node& node) {
+        const Node* base = baseline_.find(key);
+
+        DeltaEntry entry;
+        entry.key = key;
+        entry.visitDelta = node.getVisitCount() -
+                           (base ? base->getVisitCount() : 0);
+        bool changed = entry.visitDelta != 0;
+        for (int i = 0; i < node.numActions(); ++i) {
+            entry.regretDelta[i] = node.getRegretSum()[i] -
+                                   (base ? base->getRegretSum()[i] : 0.0);
+            entry.strategyDelta[i] = node.getStrategySum()[i] -
+                                     (base ? base->getStrategySum()[i] : 0.0);
+            changed = changed || entry.regretDelta[i] != 0.0 ||
+                      entry.strategyDelta[i] != 0.0;
+        }
+        if (!changed) {
+            return;
+        }
+
+        // The file stores one action count; mixed node widths are not
+        // expected in AoF (decision nodes are all FOLD/ALL_IN)
+        if (numActions == 0) {
+            numActions = static_cast<std::uint32_t>(node.numActions());
+        } else if (numActions != static_cast<std::uint32_t>(node.numActions())) {
+            std::cerr << "Warning: skipping delta for node with "
+                      << node.numActions() << " actions (file uses "
+                      << numActions << ")" << std::endl;
+            return;
+        }
+
+        entries.push_back(entry);
+    });
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw std::runtime_error("Cannot create delta file: " + path);
+    }
+
+    strategy_file::Header header{};
+    std::memcpy(header.magic, strategy_file::REGRET_MAGIC, sizeof(header.magic));
+    header.version = strategy_file::REGRET_VERSION;
+    header.numActions = numActions;
+    header.entryCount = entries.size();
+    header.slotCount = 0;
+    header.indexOffset = 0;
+    header.entriesOffset = sizeof(strategy_file::Header);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (const auto& entry : entries) {
+        strategy_file::EntryHeader entryHeader{entry.key, entry.visitDelta};
+        file.write(reinterpret_cast<const char*>(&entryHeader), sizeof(entryHeader));
+        file.write(reinterpret_cast<const char*>(entry.regretDelta.data()),
+                   numActions * sizeof(double));
+        file.write(reinterpret_cast<const char*>(entry.strategyDelta.data()),
+                   numActions * sizeof(double));
+    }
+
+    return entries.size();
+}
+
+std::size_t DistributedSync::mergeRemoteDeltas(FlatNodeMap& target) {
+    // Collect unconsumed (worker, epoch) pairs from the directory
+    std::vector<std::pair<int, int>> pending;
+    for (const auto& dirEntry : std::filesystem::directory_iterator(syncDirectory_)) {
+        const std::string name = dirEntry.path().filename().string();
+        int workerId = -1;
+        int epoch = -1;
+        if (std::sscanf(name.c_str(), "regrets_w%d_e%d.bin", &workerId, &epoch) != 2) {
+            continue;
+        }
+        if (workerId == workerId_) {
+            continue;
+        }
+
+        auto consumed = consumedEpochs_.find(workerId);
+        if (consumed == consumedEpochs_.end() || epoch > consumed->second) {
+            pending.emplace_back(workerId, epoch);
+        }
+    }
+    std::sort(pending.begin(), pending.end());
+
+    std::size_t merged = 0;
+    for (const auto& [workerId, epoch] : pending) {
+        if (applyDeltaFile(deltaPath(workerId, epoch), target)) {
+            ++merged;
+        }
+        // Advance even past unreadable files so a pruned epoch cannot
+        // stall consumption forever (its sums are lost, not repeated)
+        auto& consumed = consumedEpochs_[workerId];
+        consumed = std::max(consumed, epoch);
+    }
+    return merged;
+}
+
+bool DistributedSync::applyDeltaFile(const std::string& path, FlatNodeMap& target) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    strategy_file::Header header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file ||
+        std::memcmp(header.magic, strategy_file::REGRET_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != strategy_file::REGRET_VERSION ||
+        header.numActions > static_cast<std::uint32_t>(Node::MAX_ACTIONS)) {
+        std::cerr << "Warning: ignoring malformed delta file " << path << std::endl;
+        return false;
+    }
+
+    int numActions = static_cast<int>(header.numActions);
+    std::array<double, Node::MAX_ACTIONS> regretDelta{};
+    std::array<double, Node::MAX_ACTIONS> strategyDelta{};
+
+    for (std::uint64_t i = 0; i < header.entryCount; ++i) {
+        strategy_file::EntryHeader entryHeader{};
+        file.read(reinterpret_cast<char*>(&entryHeader), sizeof(entryHeader));
+        file.read(reinterpret_cast<char*>(regretDelta.data()),
+                  numActions * sizeof(double));
+        file.read(reinterpret_cast<char*>(strategyDelta.data()),
+                  numActions * sizeof(double));
+        if (!file) {
+            std::cerr << "Warning: truncated delta file " << path << std::endl;
+            return false;
+        }
+
+        target.getOrCreate(entryHeader.key, numActions)
+            .accumulate(regretDelta.data(), strategyDelta.data(),
+                        entryHeader.visitCount);
+
+        // Track the merged sums in the baseline as well so they are not
+        // re-published as this worker's own progress
+        baseline_.getOrCreate(entryHeader.key, numActions)
+            .accumulate(regretDelta.data(), strategyDelta.data(),
+                        entryHeader.visitCount);
+    }
+    return true;
+}
+
+} // namespace mccfr
@@ -0,0 +1,109 @@
+#include "mccfr/flat_node_map.hpp"
+#include "aof/profiling.hpp"
+#include <utility>
+
+namespace mccfr {
+
+FlatNodeMap::FlatNodeMap(std::size_t initialCapacity)
+    : slots_(roundUpCapacity(initialCapacity))
+    , size_(0)
+{
+}
+
+Node& FlatNodeMap::getOrCreate(InfoSetKey key, int numActions) {
+    if ((size_ + 1) * 10 > slots_.size() * 7) {  // Keep load factor below 0.7
+        grow();
+    }
+
+    std::size_t index = probeSlot(key);
+    Slot& slot = slots_[index];
+
+    if (!slot.occupied) {
+        AOF_PROF_COUNT(NODE_MAP_MISS);
+        slot.key = key;
+        slot.node = Node(numActions);
+        slot.occupied = true;
+        ++size_;
+        if (initializer_) {
+            initializer_(key, slot.node);
+        }
+    }
+
+    return slot.node;
+}
+
+Node* FlatNodeMap::find(InfoSetKey key) noexcept {
+    Slot& slot = slots_[probeSlot(key)];
+    return slot.occupied ? &slot.node : nullptr;
+}
+
+const Node* FlatNodeMap::find(InfoSetKey key) const noexcept {
+    const Slot& slot = slots_[probeSlot(key)];
+    return slot.occupied ? &slot.node : nullptr;
+}
+
+void FlatNodeMap::clear() {
+    for (auto& slot : slots_) {
+        slot = Slot{};
+    }
+    size_ = 0;
+}
+
+void FlatNodeMap::reserve(std::size_t count) {
+    std::size_t needed = roundUpCapacity(count * 10 / 7 + 1);
+    if (needed <= slots_.size()) {
+        return;
+    }
+
+    std::vector<Slot> oldSlots = std::move(slots_);
+    slots_.assign(needed, Slot{});
+    size_ = 0;
+
+    for (auto& slot : oldSlots) {
+        if (slot.occupied) {
+            std::size_t index = probeSlot(slot.key);
+            slots_[index].key = slot.key;
+            slots_[index].node = std::move(slot.node);
+            slots_[index].occupied = true;
+            ++size_;
+        }
+    }
+}
+
+std::size_t FlatNodeMap::hashKey(InfoSetKey key) noexcept {
+    // splitmix64 finalizer: cheap and well-distributed for packed keys
+    std::uint64_t h = key;
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return static_cast<std::size_t>(h);
+}
+
+std::size_t FlatNodeMap::probeSlot(InfoSetKey key) const noexcept {
+    std::size_t mask = slots_.size() - 1;
+    std::size_t index = hashKey(key) & mask;
+
+    AOF_PROF_COUNT(NODE_MAP_PROBE);
+    while (slots_[index].occupied && slots_[index].key != key) {
+        AOF_PROF_COUNT(NODE_MAP_PROBE);
+        index = (index + 1) & mask;
+    }
+
+    return index;
+}
+
+void FlatNodeMap::grow() {
+    reserve(slots_.size());  // reserve doubles via the load-factor headroom
+}
+
+std::size_t FlatNodeMap::roundUpCapacity(std::size_t capacity) noexcept {
+    std::size_t rounded = 16;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+    return rounded;
+}
+
+} // namespace mccfr
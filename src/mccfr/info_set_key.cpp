@@ -0,0 +1,234 @@
+#include "mccfr/info_set_key.hpp"
+#include "aof/profiling.hpp"
+#include "aof/card.hpp"
+#include "aof/game_config.hpp"
+#include <array>
+#include <sstream>
+#include <cmath>
+
+namespace mccfr {
+namespace utils {
+
+namespace {
+
+// Per-position status values inside the key (2 bits each)
+constexpr std::uint64_t STATUS_NOT_VISIBLE = 0;
+constexpr std::uint64_t STATUS_PENDING = 1;
+constexpr std::uint64_t STATUS_FOLDED = 2;
+constexpr std::uint64_t STATUS_ALL_IN = 3;
+
+// Field offsets within the key
+constexpr int STATUS_SHIFT = 2;
+constexpr int BUCKET_SHIFT = 10;
+constexpr int POT_SHIFT = 18;
+
+constexpr std::uint64_t PLAYER_MASK = 0x3;
+constexpr std::uint64_t STATUS_FIELD_MASK = 0x3;
+constexpr std::uint64_t BUCKET_MASK = 0xFF;
+constexpr std::uint64_t POT_MASK = 0xFFFFF;
+
+/// Whether `observed` position's status is visible to `player` (matches
+/// the visibility rule used by getInformationSet)
+bool isVisible(int player, int observed) noexcept {
+    if (observed == player) {
+        return false;
+    }
+    return player <= 1 || observed < player;
+}
+
+/// The 169 labels as std::strings (views over the compile-time table in
+/// card_utils, materialized once for callers that want std::string)
+const std::array<std::string, 169>& bucketLabels() {
+    static const std::array<std::string, 169> labels = [] {
+        std::array<std::string, 169> out;
+        for (int i = 0; i < aof::card_utils::NUM_HOLE_BUCKETS; ++i) {
+            out[i] = aof::card_utils::getBucketLabel(i);
+        }
+        return out;
+    }();
+    return labels;
+}
+
+/// Format a pot value the way getInformationSet's stringstream does
+std::string formatPot(double pot) {
+    std::ostringstream ss;
+    ss << pot;
+    return ss.str();
+}
+
+} // namespace
+
+int holeBucketId(const aof::Card& card1, const aof::Card& card2) noexcept {
+    return aof::card_utils::getBucketId(card1, card2);
+}
+
+const std::string& holeBucketLabel(int bucketId) {
+    return bucketLabels()[bucketId];
+}
+
+InfoSetKey encodeInfoSet(const aof::GameState& state, int player) {
+    const auto& holeCards = state.getHoleCards();
+    if (holeCards.size() < static_cast<std::size_t>((player + 1) * 2)) {
+        // Hole cards not dealt yet: encode with an empty bucket field
+        return encodeInfoSet(player, state.getFoldedMask(), state.getAllInMask(),
+                             aof::Card(), aof::Card(), state.getPot());
+    }
+
+    return encodeInfoSet(player, state.getFoldedMask(), state.getAllInMask(),
+                         holeCards[player * 2], holeCards[player * 2 + 1],
+                         state.getPot());
+}
+
+InfoSetKey encodeInfoSet(int player, std::uint8_t foldedMask,
+                         std::uint8_t allInMask, const aof::Card& card1,
+                         const aof::Card& card2, double pot) {
+    AOF_PROF_COUNT(INFOSET_ENCODE);
+    InfoSetKey key = static_cast<InfoSetKey>(player) & PLAYER_MASK;
+
+    for (int p = 0; p < aof::GameConfig::NUM_PLAYERS; ++p) {
+        std::uint64_t status = STATUS_NOT_VISIBLE;
+        if (isVisible(player, p)) {
+            if ((foldedMask >> p) & 1) {
+                status = STATUS_FOLDED;
+            } else if ((allInMask >> p) & 1) {
+                status = STATUS_ALL_IN;
+            } else {
+                status = STATUS_PENDING;
+            }
+        }
+        key |= status << (STATUS_SHIFT + 2 * p);
+    }
+
+    if (card1.isValid() && card2.isValid()) {
+        int bucket = holeBucketId(card1, card2);
+        key |= (static_cast<InfoSetKey>(bucket) & BUCKET_MASK) << BUCKET_SHIFT;
+    }
+
+    std::uint64_t potTenths = static_cast<std::uint64_t>(
+        std::llround(pot * 10.0));
+    key |= (potTenths & POT_MASK) << POT_SHIFT;
+
+    return key;
+}
+
+int keyPosition(InfoSetKey key) noexcept {
+    return static_cast<int>(key & PLAYER_MASK);
+}
+
+int keyBucket(InfoSetKey key) noexcept {
+    return static_cast<int>((key >> BUCKET_SHIFT) & BUCKET_MASK);
+}
+
+std::uint8_t keyStatusBits(InfoSetKey key) noexcept {
+    return static_cast<std::uint8_t>((key >> STATUS_SHIFT) & 0xFF);
+}
+
+InfoSetKey keyStructure(InfoSetKey key) noexcept {
+    return key & ~(POT_MASK << POT_SHIFT);
+}
+
+double keyPot(InfoSetKey key) noexcept {
+    return static_cast<double>((key >> POT_SHIFT) & POT_MASK) / 10.0;
+}
+
+std::string decodeInfoSetString(InfoSetKey key) {
+    int player = static_cast<int>(key & PLAYER_MASK);
+    int bucket = static_cast<int>((key >> BUCKET_SHIFT) & BUCKET_MASK);
+    double pot = static_cast<double>((key >> POT_SHIFT) & POT_MASK) / 10.0;
+
+    std::ostringstream ss;
+    ss << "P" << player << ":";
+
+    for (int p = 0; p < aof::GameConfig::NUM_PLAYERS; ++p) {
+        std::uint64_t status = (key >> (STATUS_SHIFT + 2 * p)) & STATUS_FIELD_MASK;
+        if (status == STATUS_NOT_VISIBLE) {
+            continue;
+        }
+
+        ss << "[P" << p << ":";
+        if (status == STATUS_FOLDED) {
+            ss << "F";
+        } else if (status == STATUS_ALL_IN) {
+            ss << "A";
+        } else {
+            ss << "P";
+        }
+        ss << "]";
+    }
+
+    ss << holeBucketLabel(bucket) << " Pot:" << formatPot(pot);
+    return ss.str();
+}
+
+bool parseInfoSetString(const std::string& infoSet, InfoSetKey& key) {
+    if (infoSet.size() < 3 || infoSet[0] != 'P') {
+        return false;
+    }
+
+    int player = infoSet[1] - '0';
+    if (player < 0 || player >= aof::GameConfig::NUM_PLAYERS || infoSet[2] != ':') {
+        return false;
+    }
+
+    key = static_cast<InfoSetKey>(player) & PLAYER_MASK;
+
+    // Opponent status blocks: "[P<idx>:<F|A|P>]"
+    std::size_t pos = 3;
+    while (pos + 4 < infoSet.size() && infoSet[pos] == '[') {
+        int p = infoSet[pos + 2] - '0';
+        char statusChar = infoSet[pos + 4];
+        if (infoSet[pos + 1] != 'P' || infoSet[pos + 3] != ':' ||
+            p < 0 || p >= aof::GameConfig::NUM_PLAYERS || infoSet[pos + 5] != ']') {
+            return false;
+        }
+
+        std::uint64_t status;
+        switch (statusChar) {
+            case 'F': status = STATUS_FOLDED; break;
+            case 'A': status = STATUS_ALL_IN; break;
+            case 'P': status = STATUS_PENDING; break;
+            default: return false;
+        }
+        key |= status << (STATUS_SHIFT + 2 * p);
+        pos += 6;
+    }
+
+    // Hole-card bucket label up to the space before "Pot:"
+    std::size_t spacePos = infoSet.find(' ', pos);
+    if (spacePos == std::string::npos) {
+        return false;
+    }
+
+    std::string label = infoSet.substr(pos, spacePos - pos);
+    const auto& labels = bucketLabels();
+    int bucket = -1;
+    for (int id = 0; id < 169; ++id) {
+        if (labels[id] == label) {
+            bucket = id;
+            break;
+        }
+    }
+    if (bucket < 0) {
+        return false;
+    }
+    key |= (static_cast<InfoSetKey>(bucket) & BUCKET_MASK) << BUCKET_SHIFT;
+
+    // Pot value
+    if (infoSet.compare(spacePos + 1, 4, "Pot:") != 0) {
+        return false;
+    }
+
+    double pot = 0.0;
+    try {
+        pot = std::stod(infoSet.substr(spacePos + 5));
+    } catch (const std::exception&) {
+        return false;
+    }
+    std::uint64_t potTenths = static_cast<std::uint64_t>(std::llround(pot * 10.0));
+    key |= (potTenths & POT_MASK) << POT_SHIFT;
+
+    return true;
+}
+
+} // namespace utils
+} // namespace mccfr
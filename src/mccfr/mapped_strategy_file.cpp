@@ -0,0 +1,283 @@
+#include "mccfr/mapped_strategy_file.hpp"
+#include "mccfr/info_set_key.hpp"
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace mccfr {
+
+MappedStrategyFile::~MappedStrategyFile() {
+    close();
+}
+
+MappedStrategyFile::MappedStrategyFile(MappedStrategyFile&& other) noexcept
+    : mapping_(other.mapping_)
+    , mappingSize_(other.mappingSize_)
+    , header_(other.header_)
+    , slots_(other.slots_)
+    , entries_(other.entries_)
+    , byVisits_(other.byVisits_)
+    , byField_(other.byField_)
+{
+    other.mapping_ = nullptr;
+    other.mappingSize_ = 0;
+    other.header_ = nullptr;
+    other.slots_ = nullptr;
+    other.entries_ = nullptr;
+    other.byVisits_ = nullptr;
+    other.byField_ = nullptr;
+}
+
+MappedStrategyFile& MappedStrategyFile::operator=(MappedStrategyFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        mapping_ = std::exchange(other.mapping_, nullptr);
+        mappingSize_ = std::exchange(other.mappingSize_, std::size_t{0});
+        header_ = std::exchange(other.header_, nullptr);
+        slots_ = std::exchange(other.slots_, nullptr);
+        entries_ = std::exchange(other.entries_, nullptr);
+        byVisits_ = std::exchange(other.byVisits_, nullptr);
+        byField_ = std::exchange(other.byField_, nullptr);
+    }
+    return *this;
+}
+
+bool MappedStrategyFile::open(const std::string& filename) {
+    close();
+
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 ||
+        static_cast<std::size_t>(st.st_size) < sizeof(strategy_file::Header)) {
+        ::close(fd);
+        return false;
+    }
+
+    std::size_t fileSize = static_cast<std::size_t>(st.st_size);
+    void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+
+    // The mapping keeps its own reference to the file
+    ::close(fd);
+
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+
+    const auto* header = static_cast<const strategy_file::Header*>(mapping);
+
+    // Validate the header before trusting any offset in it
+    bool valid =
+        std::memcmp(header->magic, strategy_file::MAGIC, sizeof(strategy_file::MAGIC)) == 0 &&
+        header->version == strategy_file::VERSION &&
+        header->numActions > 0 &&
+        header->slotCount > 0 &&
+        (header->slotCount & (header->slotCount - 1)) == 0 &&
+        header->indexOffset + header->slotCount * sizeof(strategy_file::IndexSlot) <= fileSize &&
+        header->entriesOffset +
+            header->entryCount * strategy_file::entryStride(header->numActions) <= fileSize;
+
+    if (!valid) {
+        munmap(mapping, fileSize);
+        return false;
+    }
+
+    mapping_ = mapping;
+    mappingSize_ = fileSize;
+    header_ = header;
+    slots_ = reinterpret_cast<const strategy_file::IndexSlot*>(
+        static_cast<const char*>(mapping) + header->indexOffset);
+    entries_ = static_cast<const char*>(mapping) + header->entriesOffset;
+
+    // The analytics index is optional (older files carry a zero offset);
+    // an index that does not fit the file is ignored rather than trusted
+    if (header->analyticsOffset != 0 &&
+        header->analyticsOffset +
+            strategy_file::analyticsSize(header->entryCount) <= fileSize) {
+        byVisits_ = reinterpret_cast<const std::uint64_t*>(
+            static_cast<const char*>(mapping) + header->analyticsOffset);
+        byField_ = byVisits_ + header->entryCount;
+    }
+    return true;
+}
+
+void MappedStrategyFile::close() {
+    if (mapping_ != nullptr) {
+        munmap(mapping_, mappingSize_);
+    }
+    mapping_ = nullptr;
+    mappingSize_ = 0;
+    header_ = nullptr;
+    slots_ = nullptr;
+    entries_ = nullptr;
+    byVisits_ = nullptr;
+    byField_ = nullptr;
+}
+
+std::size_t MappedStrategyFile::size() const noexcept {
+    return header_ ? static_cast<std::size_t>(header_->entryCount) : 0;
+}
+
+int MappedStrategyFile::numActions() const noexcept {
+    return header_ ? static_cast<int>(header_->numActions) : 0;
+}
+
+const double* MappedStrategyFile::findStrategy(InfoSetKey key) const noexcept {
+    const auto* entry = findEntry(key);
+    if (entry == nullptr) {
+        return nullptr;
+    }
+    return reinterpret_cast<const double*>(
+        reinterpret_cast<const char*>(entry) + sizeof(strategy_file::EntryHeader));
+}
+
+std::uint64_t MappedStrategyFile::getVisitCount(InfoSetKey key) const noexcept {
+    const auto* entry = findEntry(key);
+    return entry ? entry->visitCount : 0;
+}
+
+std::vector<double> MappedStrategyFile::getStrategy(const std::string& infoSet) const {
+    InfoSetKey key = 0;
+    if (!utils::parseInfoSetString(infoSet, key)) {
+        return {};
+    }
+
+    const double* probs = findStrategy(key);
+    if (probs == nullptr) {
+        return {};
+    }
+    return std::vector<double>(probs, probs + header_->numActions);
+}
+
+std::vector<StrategyEntryView> MappedStrategyFile::topByVisits(std::size_t k) const {
+    std::vector<StrategyEntryView> result;
+    if (byVisits_ == nullptr) {
+        return result;
+    }
+
+    std::size_t count = std::min<std::size_t>(k, header_->entryCount);
+    result.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        result.push_back(entryView(byVisits_[i]));
+    }
+    return result;
+}
+
+std::vector<StrategyEntryView> MappedStrategyFile::filterEntries(
+    int position, int bucket, double minPot) const {
+    std::vector<StrategyEntryView> result;
+    if (byField_ == nullptr) {
+        return result;
+    }
+
+    // Rank of an entry in the field order; the index is sorted by it
+    auto rankOf = [this](std::uint64_t index) {
+        StrategyEntryView view = entryView(index);
+        return std::make_tuple(utils::keyPosition(view.key),
+                               utils::keyBucket(view.key),
+                               utils::keyPot(view.key), view.key);
+    };
+
+    // Collect one contiguous index range for a fixed position; pot is
+    // the third sort key, so minPot also binary-searches when the
+    // bucket is fixed and is a filter otherwise
+    auto collectPosition = [&](int pos) {
+        int bucketLow = (bucket >= 0) ? bucket : 0;
+        double potLow = (bucket >= 0) ? minPot : 0.0;
+        auto lowRank = std::make_tuple(pos, bucketLow, potLow, InfoSetKey{0});
+
+        const std::uint64_t* begin = byField_;
+        const std::uint64_t* end = byField_ + header_->entryCount;
+        const std::uint64_t* it = std::lower_bound(
+            begin, end, lowRank,
+            [&](std::uint64_t index, const decltype(lowRank)& rank) {
+                return rankOf(index) < rank;
+            });
+
+        for (; it != end; ++it) {
+            StrategyEntryView view = entryView(*it);
+            if (utils::keyPosition(view.key) != pos ||
+                (bucket >= 0 && utils::keyBucket(view.key) != bucket)) {
+                break;
+            }
+            if (utils::keyPot(view.key) >= minPot) {
+                result.push_back(view);
+            }
+        }
+    };
+
+    if (position >= 0) {
+        collectPosition(position);
+    } else {
+        for (int pos = 0; pos < 4; ++pos) {
+            collectPosition(pos);
+        }
+    }
+    return result;
+}
+
+std::vector<double> MappedStrategyFile::averageActionFrequencyByBucket(
+    int actionIndex) const {
+    std::vector<double> averages(169, 0.0);
+    if (header_ == nullptr || actionIndex < 0 ||
+        actionIndex >= static_cast<int>(header_->numActions)) {
+        return averages;
+    }
+
+    std::vector<std::uint64_t> counts(averages.size(), 0);
+    for (std::uint64_t i = 0; i < header_->entryCount; ++i) {
+        StrategyEntryView view = entryView(i);
+        int bucket = utils::keyBucket(view.key);
+        averages[bucket] += view.strategy[actionIndex];
+        ++counts[bucket];
+    }
+    for (std::size_t bucket = 0; bucket < averages.size(); ++bucket) {
+        if (counts[bucket] > 0) {
+            averages[bucket] /= static_cast<double>(counts[bucket]);
+        }
+    }
+    return averages;
+}
+
+const strategy_file::EntryHeader* MappedStrategyFile::findEntry(InfoSetKey key) const noexcept {
+    if (header_ == nullptr || header_->entryCount == 0) {
+        return nullptr;
+    }
+
+    std::uint64_t mask = header_->slotCount - 1;
+    std::uint64_t slot = strategy_file::hashKey(key) & mask;
+
+    // Linear probe; the writer guarantees the index is never full
+    while (true) {
+        const strategy_file::IndexSlot& candidate = slots_[slot];
+        if (candidate.entryPlusOne == 0) {
+            return nullptr;
+        }
+        if (candidate.key == key) {
+            std::size_t offset = static_cast<std::size_t>(candidate.entryPlusOne - 1) *
+                                 strategy_file::entryStride(header_->numActions);
+            return reinterpret_cast<const strategy_file::EntryHeader*>(entries_ + offset);
+        }
+        slot = (slot + 1) & mask;
+    }
+}
+
+StrategyEntryView MappedStrategyFile::entryView(std::uint64_t index) const noexcept {
+    const char* raw = entries_ +
+        index * strategy_file::entryStride(header_->numActions);
+    const auto* entry = reinterpret_cast<const strategy_file::EntryHeader*>(raw);
+    return StrategyEntryView{
+        entry->key, entry->visitCount,
+        reinterpret_cast<const double*>(raw + sizeof(strategy_file::EntryHeader))};
+}
+
+} // namespace mccfr
@@ -4,6 +4,7 @@
  */
 
 #include "mccfr/realtime_visualizer.hpp"
+#include "mccfr/shm_telemetry.hpp"
 #include <iostream>
 #include <iomanip>
 #include <sstream>
@@ -34,10 +35,26 @@ bool RealtimeVisualizer::start() {
     }
     
     std::cout << "🚀 Starting real-time visualization...\n";
-    
+
+    // Map the shared-memory ring before the first data point so external
+    // consumers can attach at any time during training
+    if (!config_.sharedMemoryFile.empty()) {
+        shmWriter_ = std::make_unique<shm_telemetry::ShmTelemetryWriter>();
+        if (shmWriter_->create(config_.sharedMemoryFile)) {
+            std::cout << "  Shared-memory telemetry: " << config_.sharedMemoryFile
+                      << " (visualizer.py --live " << config_.sharedMemoryFile << ")\n";
+        } else {
+            std::cerr << "Warning: could not create telemetry ring "
+                      << config_.sharedMemoryFile << "; continuing without it\n";
+            shmWriter_.reset();
+        }
+    }
+
     // Start web server for localhost visualization
-    startWebServer();
-    
+    if (config_.enableWebServer) {
+        startWebServer();
+    }
+
     // Start visualization thread
     running_ = true;
     shouldStop_ = false;
@@ -60,8 +77,7 @@ void RealtimeVisualizer::stop() {
     
     // Signal threads to stop
     shouldStop_ = true;
-    dataCondition_.notify_all();
-    
+
     // Wait for visualization thread
     if (visualizationThread_.joinable()) {
         visualizationThread_.join();
@@ -69,7 +85,11 @@ void RealtimeVisualizer::stop() {
     
     // Stop web server
     stopWebServer();
-    
+
+    // Unmap the ring; the backing file stays behind so a dashboard can
+    // still show the finished run
+    shmWriter_.reset();
+
     running_ = false;
     std::cout << "✓ Real-time visualization stopped.\n";
 }
@@ -78,59 +98,48 @@ void RealtimeVisualizer::addDataPoint(const TrainingDataPoint& dataPoint) {
     if (!running_) {
         return;
     }
-    
-    {
-        std::lock_guard<std::mutex> lock(dataMutex_);
-        
-        // Add new data point
-        dataPoints_.push_back(dataPoint);
-        
-        // Limit data points to prevent memory growth
-        while (dataPoints_.size() > static_cast<size_t>(config_.maxDataPoints)) {
-            dataPoints_.pop_front();
-        }
-    }
-    
-    // Notify visualization thread
-    dataCondition_.notify_one();
-    
-    // Send data to web clients
-    if (webServerRunning_) {
-        broadcastDataToClients(dataPoint);
-    }
-    
-    // Print console stats if enabled
-    if (config_.showConsoleStats && dataPoint.iteration % (config_.updateInterval * 10) == 0) {
-        printConsoleStats(dataPoint);
+
+    // Zero-copy path first: one memcpy and a release-store straight from
+    // the training thread, no syscalls and no serialization
+    if (shmWriter_) {
+        shmWriter_->publish(dataPoint);
     }
+
+    // Wait-free hand-off; serialization, web broadcast and console
+    // output all happen on the visualization thread
+    dataQueue_.push(dataPoint);
 }
 
 void RealtimeVisualizer::visualizationLoop() {
     std::cout << "📊 Visualization loop started\n";
-    
+
     while (!shouldStop_) {
-        std::unique_lock<std::mutex> lock(dataMutex_);
-        
-        // Wait for new data or stop signal
-        dataCondition_.wait(lock, [this] { 
-            return !dataPoints_.empty() || shouldStop_; 
-        });
-        
-        if (shouldStop_) {
-            break;
+        TrainingDataPoint dataPoint;
+        bool gotData = false;
+
+        // Drain everything the trainer produced since the last pass; the
+        // ring drops the oldest points on overflow, so this stays bounded
+        while (dataQueue_.tryPop(dataPoint)) {
+            gotData = true;
+
+            if (config_.showConsoleStats &&
+                dataPoint.iteration % (config_.updateInterval * 10) == 0) {
+                printConsoleStats(dataPoint);
+            }
         }
-        
-        // Process available data points
-        if (!dataPoints_.empty()) {
+
+        if (gotData) {
             updatePlots();
+
+            if (webServerRunning_) {
+                broadcastDataToClients(dataPoint);
+            }
         }
-        
-        lock.unlock();
-        
+
         // Small delay to prevent excessive CPU usage
         std::this_thread::sleep_for(std::chrono::milliseconds(50));
     }
-    
+
     std::cout << "📊 Visualization loop stopped\n";
 }
 
@@ -146,12 +155,12 @@ void RealtimeVisualizer::printConsoleStats(const TrainingDataPoint& latest) {
     std::cout << "Sum: " << std::setprecision(2) << latest.utilitySum << " | ";
     std::cout << "Utilities: [";
     
-    for (size_t i = 0; i < latest.playerUtilities.size(); ++i) {
+    for (std::int32_t i = 0; i < latest.numPlayers; ++i) {
         if (i > 0) std::cout << ", ";
         std::cout << std::fixed << std::setprecision(4) << latest.playerUtilities[i];
     }
-    
-    std::cout << "] | Time: " << latest.elapsedTime.count() << "ms";
+
+    std::cout << "] | Time: " << latest.elapsedMs << "ms";
     
     // Zero-sum indicator
     if (std::abs(latest.utilitySum) < 1e-10) {
@@ -238,9 +247,9 @@ void RealtimeVisualizer::broadcastDataToClients(const TrainingDataPoint& dataPoi
     json << "\"iteration\":" << dataPoint.iteration << ",";
     json << "\"mae\":" << std::scientific << std::setprecision(6) << dataPoint.meanAbsoluteError << ",";
     json << "\"sum\":" << std::setprecision(6) << dataPoint.utilitySum << ",";
-    json << "\"time\":" << dataPoint.elapsedTime.count() << ",";
+    json << "\"time\":" << dataPoint.elapsedMs << ",";
     json << "\"utilities\":[";
-    for (size_t i = 0; i < dataPoint.playerUtilities.size(); ++i) {
+    for (std::int32_t i = 0; i < dataPoint.numPlayers; ++i) {
         if (i > 0) json << ",";
         json << std::fixed << std::setprecision(6) << dataPoint.playerUtilities[i];
     }
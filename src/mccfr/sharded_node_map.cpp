@@ -0,0 +1,73 @@
+#include "mccfr/sharded_node_map.hpp"
+
+namespace mccfr {
+
+ShardedNodeMap::LockedNode ShardedNodeMap::getOrCreate(InfoSetKey key,
+                                                       int numActions) {
+    Shard& shard = shards_[shardIndex(key)];
+    std::unique_lock<std::mutex> lock(shard.mutex);
+
+    auto it = shard.nodes.find(key);
+    if (it == shard.nodes.end()) {
+        it = shard.nodes.emplace(key, Node(numActions)).first;
+        if (initializer_) {
+            initializer_(key, it->second);
+        }
+    }
+
+    return LockedNode{it->second, std::move(lock)};
+}
+
+std::size_t ShardedNodeMap::size() const {
+    std::size_t total = 0;
+    for (const auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        total += shard.nodes.size();
+    }
+    return total;
+}
+
+void ShardedNodeMap::mergeInto(FlatNodeMap& target) {
+    target.reserve(target.size() + size());
+
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (auto& [key, node] : shard.nodes) {
+            Node& slot = target.getOrCreate(
+                key, node.numActions());
+            slot = std::move(node);
+        }
+        shard.nodes.clear();
+    }
+}
+
+void ShardedNodeMap::copyInto(FlatNodeMap& target) const {
+    target.reserve(target.size() + size());
+
+    for (const auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (const auto& [key, node] : shard.nodes) {
+            Node& slot = target.getOrCreate(
+                key, node.numActions());
+            slot = node;
+        }
+    }
+}
+
+void ShardedNodeMap::clear() {
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.nodes.clear();
+    }
+}
+
+std::size_t ShardedNodeMap::shardIndex(InfoSetKey key) noexcept {
+    // splitmix64-style mix so adjacent packed keys spread across shards
+    std::uint64_t h = key;
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    return static_cast<std::size_t>(h) & (NUM_SHARDS - 1);
+}
+
+} // namespace mccfr
@@ -0,0 +1,206 @@
+#include "mccfr/shm_telemetry.hpp"
+#include <atomic>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace mccfr {
+namespace shm_telemetry {
+
+namespace {
+
+/// Smallest power of two >= value (and >= 8 so a slow reader has slack)
+std::size_t roundUpCapacity(std::size_t value) {
+    std::size_t capacity = 8;
+    while (capacity < value) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+} // namespace
+
+ShmTelemetryWriter::~ShmTelemetryWriter() {
+    close();
+}
+
+bool ShmTelemetryWriter::create(const std::string& filename, std::size_t capacity) {
+    close();
+
+    capacity = roundUpCapacity(capacity);
+    std::size_t size = sizeof(RingHeader) + capacity * sizeof(TrainingDataPoint);
+
+    int fd = ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    // The mapping keeps its own reference to the file
+    ::close(fd);
+
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+
+    mapping_ = mapping;
+    mappingSize_ = size;
+    header_ = static_cast<RingHeader*>(mapping);
+    records_ = static_cast<unsigned char*>(mapping) + sizeof(RingHeader);
+    capacityMask_ = capacity - 1;
+
+    // ftruncate zeroed the file; fill in the constants, then publish the
+    // header itself with the same release-store readers synchronize on
+    std::memcpy(header_->magic, MAGIC, sizeof(MAGIC));
+    header_->version = VERSION;
+    header_->recordSize = sizeof(TrainingDataPoint);
+    header_->capacity = capacity;
+    header_->sequence.store(0, std::memory_order_release);
+    return true;
+}
+
+void ShmTelemetryWriter::publish(const TrainingDataPoint& point) noexcept {
+    if (!header_) {
+        return;
+    }
+
+    // Single producer: the relaxed load reads our own previous store
+    std::uint64_t sequence = header_->sequence.load(std::memory_order_relaxed);
+
+    // Keep this record's bytes from being reordered before the previous
+    // publish's sequence store: without the store-store fence an
+    // overwrite could land while the reader still sees the old sequence,
+    // slipping past its one-lap tear check
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(records_ + (sequence & capacityMask_) * sizeof(TrainingDataPoint),
+                &point, sizeof(TrainingDataPoint));
+    header_->sequence.store(sequence + 1, std::memory_order_release);
+}
+
+std::uint64_t ShmTelemetryWriter::published() const {
+    return header_ ? header_->sequence.load(std::memory_order_relaxed) : 0;
+}
+
+void ShmTelemetryWriter::close() {
+    if (mapping_) {
+        munmap(mapping_, mappingSize_);
+    }
+    mapping_ = nullptr;
+    mappingSize_ = 0;
+    header_ = nullptr;
+    records_ = nullptr;
+    capacityMask_ = 0;
+}
+
+ShmTelemetryReader::~ShmTelemetryReader() {
+    close();
+}
+
+bool ShmTelemetryReader::open(const std::string& filename) {
+    close();
+
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 ||
+        static_cast<std::size_t>(st.st_size) < sizeof(RingHeader)) {
+        ::close(fd);
+        return false;
+    }
+
+    std::size_t fileSize = static_cast<std::size_t>(st.st_size);
+    void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+
+    // The mapping keeps its own reference to the file
+    ::close(fd);
+
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+
+    const auto* header = static_cast<const RingHeader*>(mapping);
+
+    // Validate the header before trusting any size in it
+    bool valid =
+        std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) == 0 &&
+        header->version == VERSION &&
+        header->recordSize == sizeof(TrainingDataPoint) &&
+        header->capacity > 0 &&
+        (header->capacity & (header->capacity - 1)) == 0 &&
+        sizeof(RingHeader) + header->capacity * sizeof(TrainingDataPoint) <= fileSize;
+
+    if (!valid) {
+        munmap(mapping, fileSize);
+        return false;
+    }
+
+    mapping_ = mapping;
+    mappingSize_ = fileSize;
+    header_ = header;
+    records_ = static_cast<const unsigned char*>(mapping) + sizeof(RingHeader);
+    capacity_ = header->capacity;
+    nextSequence_ = 0;
+    droppedRecords_ = 0;
+    return true;
+}
+
+bool ShmTelemetryReader::poll(TrainingDataPoint& out) {
+    if (!header_) {
+        return false;
+    }
+
+    while (true) {
+        std::uint64_t published = header_->sequence.load(std::memory_order_acquire);
+        if (published == nextSequence_) {
+            return false;
+        }
+
+        // Lapped: the slot exactly capacity_ behind may be the writer's
+        // in-flight memcpy, so resume one slot inside the intact window
+        if (published + 1 > nextSequence_ + capacity_) {
+            std::uint64_t resumeAt = published + 1 - capacity_;
+            droppedRecords_ += resumeAt - nextSequence_;
+            nextSequence_ = resumeAt;
+        }
+
+        std::memcpy(&out,
+                    records_ + (nextSequence_ & (capacity_ - 1)) * sizeof(TrainingDataPoint),
+                    sizeof(TrainingDataPoint));
+
+        // Seqlock-style validation: record nextSequence_ + capacity_
+        // reuses this slot and is in flight once the counter reaches that
+        // value, so the copy is intact only strictly below it
+        std::uint64_t after = header_->sequence.load(std::memory_order_acquire);
+        if (after < nextSequence_ + capacity_) {
+            ++nextSequence_;
+            return true;
+        }
+    }
+}
+
+void ShmTelemetryReader::close() {
+    if (mapping_) {
+        munmap(mapping_, mappingSize_);
+    }
+    mapping_ = nullptr;
+    mappingSize_ = 0;
+    header_ = nullptr;
+    records_ = nullptr;
+    capacity_ = 0;
+    nextSequence_ = 0;
+    droppedRecords_ = 0;
+}
+
+} // namespace shm_telemetry
+} // namespace mccfr
@@ -0,0 +1,90 @@
+#include "mccfr/strategy_kernels.hpp"
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace mccfr {
+namespace kernels {
+
+namespace {
+
+/// Shared scalar tail: normalize one row, with optional clamping first
+inline void normalizeRow(double* row, int numActions, bool clampNegative) {
+    double sum = 0.0;
+    for (int i = 0; i < numActions; ++i) {
+        if (clampNegative && row[i] < 0.0) {
+            row[i] = 0.0;
+        }
+        sum += row[i];
+    }
+
+    if (sum > 0.0) {
+        for (int i = 0; i < numActions; ++i) {
+            row[i] /= sum;
+        }
+    } else {
+        double uniform = 1.0 / numActions;
+        for (int i = 0; i < numActions; ++i) {
+            row[i] = uniform;
+        }
+    }
+}
+
+#if defined(__AVX2__)
+
+/// Two-action rows, two nodes per 256-bit lane: {a0, a1, b0, b1}
+void normalizePairs2(double* rows, std::size_t count, bool clampNegative) {
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d half = _mm256_set1_pd(0.5);
+
+    std::size_t pairs = count / 2;
+    for (std::size_t p = 0; p < pairs; ++p) {
+        double* base = rows + p * 4;
+        __m256d values = _mm256_loadu_pd(base);
+        if (clampNegative) {
+            values = _mm256_max_pd(values, zero);
+        }
+
+        // Row sums duplicated into both entries of each 128-bit half
+        __m256d sums = _mm256_hadd_pd(values, values);
+
+        // Rows summing to zero fall back to the uniform distribution
+        __m256d positive = _mm256_cmp_pd(sums, zero, _CMP_GT_OQ);
+        __m256d normalized = _mm256_div_pd(values, sums);
+        _mm256_storeu_pd(base, _mm256_blendv_pd(half, normalized, positive));
+    }
+
+    if (count % 2 != 0) {
+        normalizeRow(rows + (count - 1) * 2, 2, clampNegative);
+    }
+}
+
+#endif // __AVX2__
+
+void normalizeRows(double* rows, std::size_t count, int numActions,
+                   bool clampNegative) {
+#if defined(__AVX2__)
+    if (numActions == 2) {
+        normalizePairs2(rows, count, clampNegative);
+        return;
+    }
+#endif
+    for (std::size_t i = 0; i < count; ++i) {
+        normalizeRow(rows + i * numActions, numActions, clampNegative);
+    }
+}
+
+} // namespace
+
+void regretMatchRows(double* rows, std::size_t count, int numActions) {
+    normalizeRows(rows, count, numActions, true);
+}
+
+void averageStrategyRows(double* rows, std::size_t count, int numActions) {
+    normalizeRows(rows, count, numActions, false);
+}
+
+} // namespace kernels
+} // namespace mccfr
@@ -1,21 +1,59 @@
 #include "mccfr/strategy_manager.hpp"
+#include "mccfr/info_set_key.hpp"
+#include "mccfr/strategy_kernels.hpp"
 #include <fstream>
+#include <stdexcept>
 #include <sstream>
 #include <algorithm>
 #include <iostream>
 #include <iomanip>
+#include <cstring>
+#include <tuple>
 
 namespace mccfr {
 
 void StrategyManager::loadFromNodeMap(const std::unordered_map<std::string, Node>& nodeMap) {
     clear();
-    
+
     for (const auto& [infoSet, node] : nodeMap) {
         strategies_[infoSet] = node.getAverageStrategy();
         visitCounts_[infoSet] = node.getVisitCount();
     }
 }
 
+void StrategyManager::loadFromNodeMap(const FlatNodeMap& nodeMap) {
+    clear();
+
+    // Gather sums densely and normalize the whole map in one kernel pass
+    std::vector<InfoSetKey> keys;
+    std::vector<std::uint64_t> visits;
+    std::vector<double> rows;
+    keys.reserve(nodeMap.size());
+    visits.reserve(nodeMap.size());
+    rows.reserve(nodeMap.size() * 2);
+
+    int numActions = 0;
+    nodeMap.forEach([&](InfoSetKey key, const Node& node) {
+        if (numActions == 0) {
+            numActions = node.numActions();
+        } else if (node.numActions() != numActions) {
+            throw std::runtime_error("Mixed node widths in strategy export");
+        }
+        keys.push_back(key);
+        visits.push_back(node.getVisitCount());
+        rows.insert(rows.end(), node.getStrategySum().data(),
+                    node.getStrategySum().data() + numActions);
+    });
+    kernels::averageStrategyRows(rows.data(), keys.size(), numActions);
+
+    for (std::size_t n = 0; n < keys.size(); ++n) {
+        const double* row = rows.data() + n * numActions;
+        std::string infoSet = utils::decodeInfoSetString(keys[n]);
+        strategies_[infoSet] = std::vector<double>(row, row + numActions);
+        visitCounts_[infoSet] = visits[n];
+    }
+}
+
 bool StrategyManager::saveToFile(const std::string& filename, bool includeVisitCounts) const {
     std::ofstream file(filename);
     if (!file.is_open()) {
@@ -58,32 +96,117 @@ bool StrategyManager::saveToBinary(const std::string& filename) const {
     if (!file.is_open()) {
         return false;
     }
-    
-    writeBinaryHeader(file);
-    
-    // Write number of strategies
-    std::uint32_t numStrategies = static_cast<std::uint32_t>(strategies_.size());
-    file.write(reinterpret_cast<const char*>(&numStrategies), sizeof(numStrategies));
-    
-    // Write each strategy
+
+    // Collect entries whose information set strings parse into packed
+    // keys; the fixed-stride format needs a uniform action count, taken
+    // from the first entry
+    struct PendingEntry {
+        InfoSetKey key;
+        std::uint64_t visitCount;
+        const std::vector<double>* strategy;
+    };
+
+    std::vector<PendingEntry> entries;
+    entries.reserve(strategies_.size());
+    std::uint32_t numActions = 0;
+    std::size_t skipped = 0;
+
     for (const auto& [infoSet, strategy] : strategies_) {
-        // Write info set string length and data
-        std::uint32_t infoSetLen = static_cast<std::uint32_t>(infoSet.length());
-        file.write(reinterpret_cast<const char*>(&infoSetLen), sizeof(infoSetLen));
-        file.write(infoSet.c_str(), infoSetLen);
-        
-        // Write visit count
+        InfoSetKey key = 0;
+        if (strategy.empty() || !utils::parseInfoSetString(infoSet, key)) {
+            ++skipped;
+            continue;
+        }
+
+        if (numActions == 0) {
+            numActions = static_cast<std::uint32_t>(strategy.size());
+        } else if (strategy.size() != numActions) {
+            ++skipped;
+            continue;
+        }
+
         auto visitIt = visitCounts_.find(infoSet);
         std::uint64_t visitCount = (visitIt != visitCounts_.end()) ? visitIt->second : 0;
-        file.write(reinterpret_cast<const char*>(&visitCount), sizeof(visitCount));
-        
-        // Write strategy size and data
-        std::uint32_t strategySize = static_cast<std::uint32_t>(strategy.size());
-        file.write(reinterpret_cast<const char*>(&strategySize), sizeof(strategySize));
-        file.write(reinterpret_cast<const char*>(strategy.data()), 
-                  strategySize * sizeof(double));
+        entries.push_back(PendingEntry{key, visitCount, &strategy});
     }
-    
+
+    if (skipped > 0) {
+        std::cerr << "Warning: " << skipped
+                  << " strategies could not be stored in binary format\n";
+    }
+
+    // Size the index below 70% load so reader probes stay short
+    std::uint64_t slotCount = 16;
+    while (slotCount * 7 < entries.size() * 10) {
+        slotCount *= 2;
+    }
+
+    std::vector<strategy_file::IndexSlot> slots(slotCount,
+                                               strategy_file::IndexSlot{0, 0});
+    std::uint64_t mask = slotCount - 1;
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        std::uint64_t slot = strategy_file::hashKey(entries[i].key) & mask;
+        while (slots[slot].entryPlusOne != 0) {
+            slot = (slot + 1) & mask;
+        }
+        slots[slot] = strategy_file::IndexSlot{entries[i].key, i + 1};
+    }
+
+    // Sort orders for the analytics index: the keys already carry
+    // position, bucket and pot as bit-fields, so the index only has to
+    // persist entry orderings, not the fields themselves
+    std::vector<std::uint64_t> byVisits(entries.size());
+    std::vector<std::uint64_t> byField(entries.size());
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        byVisits[i] = i;
+        byField[i] = i;
+    }
+    std::sort(byVisits.begin(), byVisits.end(),
+              [&](std::uint64_t a, std::uint64_t b) {
+                  if (entries[a].visitCount != entries[b].visitCount) {
+                      return entries[a].visitCount > entries[b].visitCount;
+                  }
+                  return entries[a].key < entries[b].key;
+              });
+    auto fieldRank = [&](std::uint64_t i) {
+        return std::make_tuple(utils::keyPosition(entries[i].key),
+                               utils::keyBucket(entries[i].key),
+                               utils::keyPot(entries[i].key),
+                               entries[i].key);
+    };
+    std::sort(byField.begin(), byField.end(),
+              [&](std::uint64_t a, std::uint64_t b) {
+                  return fieldRank(a) < fieldRank(b);
+              });
+
+    strategy_file::Header header{};
+    std::memcpy(header.magic, strategy_file::MAGIC, sizeof(strategy_file::MAGIC));
+    header.version = strategy_file::VERSION;
+    header.numActions = numActions;
+    header.entryCount = entries.size();
+    header.slotCount = slotCount;
+    header.indexOffset = sizeof(strategy_file::Header);
+    header.entriesOffset = header.indexOffset +
+                           slotCount * sizeof(strategy_file::IndexSlot);
+    header.analyticsOffset = header.entriesOffset +
+                             entries.size() * strategy_file::entryStride(numActions);
+
+    writeBinaryHeader(file, header);
+    file.write(reinterpret_cast<const char*>(slots.data()),
+               slotCount * sizeof(strategy_file::IndexSlot));
+
+    for (const auto& entry : entries) {
+        strategy_file::EntryHeader entryHeader{entry.key, entry.visitCount};
+        file.write(reinterpret_cast<const char*>(&entryHeader), sizeof(entryHeader));
+        file.write(reinterpret_cast<const char*>(entry.strategy->data()),
+                   numActions * sizeof(double));
+    }
+
+    file.write(reinterpret_cast<const char*>(byVisits.data()),
+               byVisits.size() * sizeof(std::uint64_t));
+    file.write(reinterpret_cast<const char*>(byField.data()),
+               byField.size() * sizeof(std::uint64_t));
+
     return file.good();
 }
 
@@ -132,48 +255,32 @@ bool StrategyManager::loadFromBinary(const std::string& filename) {
     if (!file.is_open()) {
         return false;
     }
-    
-    if (!readBinaryHeader(file)) {
+
+    strategy_file::Header header{};
+    if (!readBinaryHeader(file, header)) {
         return false;
     }
-    
+
     clear();
-    
-    // Read number of strategies
-    std::uint32_t numStrategies;
-    file.read(reinterpret_cast<char*>(&numStrategies), sizeof(numStrategies));
+
+    // Skip the hash index: it only matters for mmap consumers, the
+    // manager rebuilds its own maps from the dense entry array
+    file.seekg(static_cast<std::streamoff>(header.entriesOffset));
     if (!file.good()) return false;
-    
-    // Read each strategy
-    for (std::uint32_t i = 0; i < numStrategies; ++i) {
-        // Read info set string
-        std::uint32_t infoSetLen;
-        file.read(reinterpret_cast<char*>(&infoSetLen), sizeof(infoSetLen));
-        if (!file.good()) return false;
-        
-        std::string infoSet(infoSetLen, '\0');
-        file.read(&infoSet[0], infoSetLen);
-        if (!file.good()) return false;
-        
-        // Read visit count
-        std::uint64_t visitCount;
-        file.read(reinterpret_cast<char*>(&visitCount), sizeof(visitCount));
-        if (!file.good()) return false;
-        
-        // Read strategy
-        std::uint32_t strategySize;
-        file.read(reinterpret_cast<char*>(&strategySize), sizeof(strategySize));
-        if (!file.good()) return false;
-        
-        std::vector<double> strategy(strategySize);
-        file.read(reinterpret_cast<char*>(strategy.data()), 
-                 strategySize * sizeof(double));
+
+    std::vector<double> strategy(header.numActions);
+    for (std::uint64_t i = 0; i < header.entryCount; ++i) {
+        strategy_file::EntryHeader entryHeader{};
+        file.read(reinterpret_cast<char*>(&entryHeader), sizeof(entryHeader));
+        file.read(reinterpret_cast<char*>(strategy.data()),
+                  header.numActions * sizeof(double));
         if (!file.good()) return false;
-        
-        strategies_[infoSet] = std::move(strategy);
-        visitCounts_[infoSet] = visitCount;
+
+        std::string infoSet = utils::decodeInfoSetString(entryHeader.key);
+        strategies_[infoSet] = strategy;
+        visitCounts_[infoSet] = entryHeader.visitCount;
     }
-    
+
     return true;
 }
 
@@ -270,25 +377,20 @@ bool StrategyManager::parseStrategyLine(const std::string& line,
     return true;
 }
 
-void StrategyManager::writeBinaryHeader(std::ofstream& file) const {
-    // Magic number and version
-    const char magic[] = "STRAT";
-    const std::uint32_t version = 1;
-    
-    file.write(magic, 5);
-    file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+void StrategyManager::writeBinaryHeader(std::ofstream& file,
+                                        const strategy_file::Header& header) const {
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
 }
 
-bool StrategyManager::readBinaryHeader(std::ifstream& file) const {
-    char magic[6] = {0};
-    std::uint32_t version;
-    
-    file.read(magic, 5);
-    file.read(reinterpret_cast<char*>(&version), sizeof(version));
-    
-    return file.good() && 
-           std::string(magic) == "STRAT" && 
-           version == 1;
+bool StrategyManager::readBinaryHeader(std::ifstream& file,
+                                       strategy_file::Header& header) const {
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+    return file.good() &&
+           std::memcmp(header.magic, strategy_file::MAGIC,
+                       sizeof(strategy_file::MAGIC)) == 0 &&
+           header.version == strategy_file::VERSION &&
+           header.numActions > 0;
 }
 
 } // namespace mccfr
@@ -0,0 +1,196 @@
+#include "mccfr/strategy_query.hpp"
+#include "mccfr/strategy_file_format.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+
+namespace mccfr {
+
+namespace {
+
+/// splitmix64 finalizer over a seeded key: one mix per probe, the seed
+/// separates the first-level bucket hash from displaced slot hashes
+inline std::uint64_t mixKey(InfoSetKey key, std::uint64_t seed) noexcept {
+    std::uint64_t z = key + seed * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/// Smallest power of two >= value (and >= 16)
+std::uint64_t nextPow2(std::size_t value) {
+    std::uint64_t result = 16;
+    while (result < value) {
+        result *= 2;
+    }
+    return result;
+}
+
+} // namespace
+
+void StrategyQueryTable::build(const StrategyManager& manager) {
+    std::vector<InfoSetKey> keys;
+    std::vector<double> rows;
+    keys.reserve(manager.size());
+
+    numActions_ = 0;
+    for (const auto& [infoSet, strategy] : manager.getAllStrategies()) {
+        InfoSetKey key = 0;
+        if (strategy.empty() || !utils::parseInfoSetString(infoSet, key)) {
+            continue;
+        }
+
+        if (numActions_ == 0) {
+            numActions_ = static_cast<int>(strategy.size());
+        } else if (strategy.size() != static_cast<std::size_t>(numActions_)) {
+            continue;
+        }
+
+        keys.push_back(key);
+        rows.insert(rows.end(), strategy.begin(), strategy.end());
+    }
+
+    buildTable(keys, rows);
+}
+
+bool StrategyQueryTable::loadFromBinary(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    strategy_file::Header header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file.good() ||
+        std::memcmp(header.magic, strategy_file::MAGIC,
+                    sizeof(strategy_file::MAGIC)) != 0 ||
+        header.version != strategy_file::VERSION ||
+        header.numActions == 0) {
+        return false;
+    }
+
+    // Read the dense entry array; the file's own hash index is ignored,
+    // the perfect hash is rebuilt over the keys
+    file.seekg(static_cast<std::streamoff>(header.entriesOffset));
+    if (!file.good()) return false;
+
+    numActions_ = static_cast<int>(header.numActions);
+    std::vector<InfoSetKey> keys;
+    std::vector<double> rows;
+    keys.reserve(header.entryCount);
+    rows.resize(header.entryCount * header.numActions);
+
+    for (std::uint64_t i = 0; i < header.entryCount; ++i) {
+        strategy_file::EntryHeader entryHeader{};
+        file.read(reinterpret_cast<char*>(&entryHeader), sizeof(entryHeader));
+        file.read(reinterpret_cast<char*>(rows.data() + i * header.numActions),
+                  header.numActions * sizeof(double));
+        if (!file.good()) return false;
+        keys.push_back(entryHeader.key);
+    }
+
+    buildTable(keys, rows);
+    return true;
+}
+
+int StrategyQueryTable::lookup(const StrategyQuery& query,
+                               double* strategy) const noexcept {
+    return lookup(utils::encodeInfoSet(query.player, query.foldedMask,
+                                       query.allInMask, query.holeCard1,
+                                       query.holeCard2, query.pot),
+                  strategy);
+}
+
+int StrategyQueryTable::lookup(InfoSetKey key, double* strategy) const noexcept {
+    if (entryCount_ == 0) {
+        return 0;
+    }
+
+    std::uint32_t displacement = displacements_[mixKey(key, 0) & bucketMask_];
+    std::uint64_t slot = mixKey(key, displacement) & slotMask_;
+    if (slotKeys_[slot] != key) {
+        return 0;
+    }
+
+    const double* row = slotStrategies_.data() + slot * numActions_;
+    for (int i = 0; i < numActions_; ++i) {
+        strategy[i] = row[i];
+    }
+    return numActions_;
+}
+
+void StrategyQueryTable::buildTable(const std::vector<InfoSetKey>& keys,
+                                    const std::vector<double>& rows) {
+    entryCount_ = keys.size();
+
+    // Two slots per key keeps displacement searches short; one bucket
+    // per ~4 keys keeps the displacement array small
+    std::uint64_t slotCount = nextPow2(entryCount_ * 2);
+    std::uint64_t bucketCount = nextPow2(entryCount_ / 4 + 1);
+    slotMask_ = slotCount - 1;
+    bucketMask_ = bucketCount - 1;
+
+    slotKeys_.assign(slotCount, EMPTY_KEY);
+    slotStrategies_.assign(slotCount * numActions_, 0.0);
+    displacements_.assign(bucketCount, 0);
+
+    // Group entry indices by first-level bucket
+    std::vector<std::vector<std::uint32_t>> buckets(bucketCount);
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        buckets[mixKey(keys[i], 0) & bucketMask_].push_back(
+            static_cast<std::uint32_t>(i));
+    }
+
+    // Place the largest buckets first while slots are plentiful
+    std::vector<std::uint32_t> bucketOrder(bucketCount);
+    std::iota(bucketOrder.begin(), bucketOrder.end(), 0u);
+    std::sort(bucketOrder.begin(), bucketOrder.end(),
+              [&](std::uint32_t a, std::uint32_t b) {
+                  return buckets[a].size() > buckets[b].size();
+              });
+
+    std::vector<std::uint64_t> slots;
+    for (std::uint32_t bucketIndex : bucketOrder) {
+        const auto& bucket = buckets[bucketIndex];
+        if (bucket.empty()) {
+            break;  // Sorted descending: the rest are empty too
+        }
+
+        // Find a displacement that lands every key of this bucket in a
+        // distinct free slot
+        for (std::uint32_t displacement = 1;; ++displacement) {
+            if (displacement == 0) {
+                throw std::runtime_error(
+                    "Strategy query table: no valid displacement found");
+            }
+
+            slots.clear();
+            bool valid = true;
+            for (std::uint32_t entry : bucket) {
+                std::uint64_t slot = mixKey(keys[entry], displacement) & slotMask_;
+                if (slotKeys_[slot] != EMPTY_KEY ||
+                    std::find(slots.begin(), slots.end(), slot) != slots.end()) {
+                    valid = false;
+                    break;
+                }
+                slots.push_back(slot);
+            }
+
+            if (valid) {
+                for (std::size_t n = 0; n < bucket.size(); ++n) {
+                    std::uint64_t slot = slots[n];
+                    slotKeys_[slot] = keys[bucket[n]];
+                    std::copy_n(rows.data() + bucket[n] * numActions_,
+                                numActions_,
+                                slotStrategies_.data() + slot * numActions_);
+                }
+                displacements_[bucketIndex] = displacement;
+                break;
+            }
+        }
+    }
+}
+
+} // namespace mccfr
@@ -0,0 +1,265 @@
+#include "mccfr/sweep.hpp"
+#include "aof/game_config.hpp"
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace mccfr {
+
+namespace {
+
+/// Serializes the per-configuration progress lines of concurrent workers
+std::mutex& outputMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+} // namespace
+
+std::vector<SweepEntry> SweepRunner::loadSweepFile(const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("Cannot open sweep file: " + filename);
+    }
+
+    std::vector<SweepEntry> entries;
+    std::string line;
+    int lineNumber = 0;
+
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        SweepEntry entry;
+        std::istringstream iss(line);
+        if (!(iss >> entry.name >> entry.smallBlind >> entry.bigBlind
+                  >> entry.iterations)) {
+            throw std::runtime_error("Malformed sweep line " +
+                                     std::to_string(lineNumber) + " in " +
+                                     filename + ": " + line);
+        }
+
+        double stack;
+        while (iss >> stack) {
+            entry.stacksBB.push_back(stack);
+        }
+
+        if (entry.smallBlind <= 0.0 || entry.bigBlind <= entry.smallBlind) {
+            throw std::runtime_error("Invalid blinds on sweep line " +
+                                     std::to_string(lineNumber) + " in " +
+                                     filename);
+        }
+        if (entry.iterations <= 0) {
+            throw std::runtime_error("Invalid iteration count on sweep line " +
+                                     std::to_string(lineNumber) + " in " +
+                                     filename);
+        }
+        if (!entry.stacksBB.empty() &&
+            entry.stacksBB.size() !=
+                static_cast<std::size_t>(aof::GameConfig::NUM_PLAYERS)) {
+            throw std::runtime_error("Expected " +
+                                     std::to_string(aof::GameConfig::NUM_PLAYERS) +
+                                     " stacks on sweep line " +
+                                     std::to_string(lineNumber) + " in " +
+                                     filename);
+        }
+
+        entries.push_back(std::move(entry));
+    }
+
+    if (entries.empty()) {
+        throw std::runtime_error("No configurations in sweep file: " + filename);
+    }
+    return entries;
+}
+
+std::vector<SweepResult> SweepRunner::run(const std::vector<SweepEntry>& entries,
+                                          const Options& options) const {
+    std::vector<SweepResult> results(entries.size());
+
+    // Fixed worker pool pulling configurations from a shared counter: the
+    // machine stays fully busy without oversubscribing it, however uneven
+    // the per-configuration iteration counts are
+    int numWorkers = std::max(1, std::min<int>(options.numWorkers,
+                                               static_cast<int>(entries.size())));
+    std::atomic<std::size_t> nextEntry{0};
+
+    std::vector<std::thread> workers;
+    workers.reserve(numWorkers);
+    for (int t = 0; t < numWorkers; ++t) {
+        workers.emplace_back([&]() {
+            while (true) {
+                std::size_t index = nextEntry.fetch_add(1, std::memory_order_relaxed);
+                if (index >= entries.size()) {
+                    break;
+                }
+                results[index] = runEntry(entries[index], index, options);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    writeSummary(results, options);
+
+    if (options.enableProgressOutput) {
+        std::lock_guard<std::mutex> lock(outputMutex());
+        std::cout << "\n=== Sweep Summary ===\n";
+        std::cout << std::left << std::setw(16) << "name"
+                  << std::right << std::setw(8) << "sb"
+                  << std::setw(8) << "bb"
+                  << std::setw(12) << "iterations"
+                  << std::setw(10) << "infosets"
+                  << std::setw(10) << "time"
+                  << std::setw(14) << "exploit" << "\n";
+        for (const auto& result : results) {
+            std::cout << std::left << std::setw(16) << result.entry.name
+                      << std::right << std::fixed << std::setprecision(2)
+                      << std::setw(8) << result.entry.smallBlind
+                      << std::setw(8) << result.entry.bigBlind
+                      << std::setw(12) << result.entry.iterations;
+            if (result.succeeded) {
+                std::cout << std::setw(10) << result.informationSets
+                          << std::setw(9) << (result.trainTime.count() / 1000) << "s";
+                if (result.exploitability >= 0.0) {
+                    std::cout << std::setprecision(6) << std::setw(14)
+                              << result.exploitability;
+                } else {
+                    std::cout << std::setw(14) << "-";
+                }
+            } else {
+                std::cout << "  FAILED: " << result.error;
+            }
+            std::cout << "\n";
+        }
+    }
+
+    return results;
+}
+
+SweepResult SweepRunner::runEntry(const SweepEntry& entry,
+                                  std::size_t entryIndex,
+                                  const Options& options) const {
+    SweepResult result;
+    result.entry = entry;
+
+    if (options.enableProgressOutput) {
+        std::lock_guard<std::mutex> lock(outputMutex());
+        std::cout << "[sweep] " << entry.name << ": training "
+                  << entry.iterations << " iterations at "
+                  << entry.smallBlind << "/" << entry.bigBlind << "\n";
+    }
+
+    try {
+        // Per-stakes rake where a structure exists, no rake otherwise —
+        // the same fallback the single-configuration CLI applies
+        aof::Stakes stakes{entry.smallBlind, entry.bigBlind};
+        aof::GameParameters gameParams;
+        try {
+            gameParams = aof::GameConfig::getGameParameters(stakes);
+        } catch (const std::invalid_argument&) {
+            gameParams = {0.0, 0.0, 0.0};
+        }
+
+        aof::Game game(entry.smallBlind, entry.bigBlind, gameParams,
+                       entry.stacksBB);
+        if (options.equityEngine) {
+            game.setEquityEngine(options.equityEngine);
+        }
+
+        Trainer trainer(game);
+
+        TrainingConfig config;
+        config.iterations = entry.iterations;
+        config.samplingScheme = options.samplingScheme;
+        config.updateRule = options.updateRule;
+        // Distinct deterministic seed per configuration so whole sweeps replay
+        config.rngSeed = (options.rngSeed != 0)
+            ? options.rngSeed + static_cast<std::uint64_t>(entryIndex) : 0;
+        config.outputPrefix = options.outputPrefix + "_" + entry.name;
+        config.enableProgressOutput = false;
+        config.enableUtilityTracking = false;
+        config.enableDataLogging = false;
+
+        result.finalUtilities = trainer.train(config);
+        result.informationSets = trainer.getStats().informationSetsCount;
+        result.trainTime = trainer.getStats().totalTime;
+
+        if (options.evaluationDeals > 0) {
+            result.exploitability =
+                trainer.computeExploitability(options.evaluationDeals)
+                    .exploitability;
+        }
+
+        result.succeeded = true;
+    } catch (const std::exception& e) {
+        result.succeeded = false;
+        result.error = e.what();
+    }
+
+    if (options.enableProgressOutput) {
+        std::lock_guard<std::mutex> lock(outputMutex());
+        if (result.succeeded) {
+            std::cout << "[sweep] " << entry.name << ": done ("
+                      << result.informationSets << " information sets, "
+                      << (result.trainTime.count() / 1000) << "s)\n";
+        } else {
+            std::cout << "[sweep] " << entry.name << ": FAILED ("
+                      << result.error << ")\n";
+        }
+    }
+
+    return result;
+}
+
+void SweepRunner::writeSummary(const std::vector<SweepResult>& results,
+                               const Options& options) const {
+    std::string filename = options.outputPrefix + "_sweep_summary.csv";
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Error: Unable to open sweep summary for writing: "
+                  << filename << "\n";
+        return;
+    }
+
+    file << "name,small_blind,big_blind,iterations,succeeded,info_sets,"
+         << "time_ms,exploitability";
+    for (int player = 0; player < aof::GameConfig::NUM_PLAYERS; ++player) {
+        file << ",utility_p" << player;
+    }
+    file << "\n";
+
+    file << std::setprecision(16);
+    for (const auto& result : results) {
+        file << result.entry.name << ","
+             << result.entry.smallBlind << ","
+             << result.entry.bigBlind << ","
+             << result.entry.iterations << ","
+             << (result.succeeded ? 1 : 0) << ","
+             << result.informationSets << ","
+             << result.trainTime.count() << ","
+             << result.exploitability;
+        for (int player = 0; player < aof::GameConfig::NUM_PLAYERS; ++player) {
+            file << ",";
+            if (static_cast<std::size_t>(player) < result.finalUtilities.size()) {
+                file << result.finalUtilities[player];
+            }
+        }
+        file << "\n";
+    }
+
+    if (file.good() && options.enableProgressOutput) {
+        std::lock_guard<std::mutex> lock(outputMutex());
+        std::cout << "Sweep summary written to: " << filename << "\n";
+    }
+}
+
+} // namespace mccfr
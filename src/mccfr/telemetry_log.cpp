@@ -0,0 +1,203 @@
+#include "mccfr/telemetry_log.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace mccfr {
+namespace telemetry_log {
+
+namespace {
+
+/// Name of the i-th rotated segment (<file>.1 is the most recent)
+std::string rotatedName(const std::string& filename, int index) {
+    return filename + "." + std::to_string(index);
+}
+
+} // namespace
+
+TelemetryLogWriter::~TelemetryLogWriter() {
+    close();
+}
+
+bool TelemetryLogWriter::open(const std::string& filename, const Options& options) {
+    close();
+
+    options_ = options;
+    filename_ = filename;
+
+    // Keep the previous run's records: an existing log becomes <file>.1
+    rotateSegments();
+    if (!openSegment()) {
+        return false;
+    }
+
+    shouldStop_.store(false, std::memory_order_relaxed);
+    open_.store(true, std::memory_order_release);
+    writerThread_ = std::thread(&TelemetryLogWriter::writerLoop, this);
+    return true;
+}
+
+void TelemetryLogWriter::append(const TelemetryRecord& record) noexcept {
+    if (!isOpen()) {
+        return;
+    }
+    queue_.push(record);
+}
+
+void TelemetryLogWriter::close() {
+    open_.store(false, std::memory_order_release);
+    if (writerThread_.joinable()) {
+        // The writer loop drains the queue and syncs before it exits
+        shouldStop_.store(true, std::memory_order_release);
+        writerThread_.join();
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+    segmentBytes_ = 0;
+}
+
+bool TelemetryLogWriter::openSegment() {
+    int fd = ::open(filename_.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+
+    FileHeader header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.recordSize = sizeof(TelemetryRecord);
+    if (::write(fd, &header, sizeof(header)) != static_cast<ssize_t>(sizeof(header))) {
+        ::close(fd);
+        return false;
+    }
+
+    fd_ = fd;
+    segmentBytes_ = sizeof(FileHeader);
+    return true;
+}
+
+void TelemetryLogWriter::rotateSegments() {
+    // Shift <file>.i -> <file>.(i+1), dropping the oldest, then move the
+    // live segment into the .1 slot
+    std::remove(rotatedName(filename_, options_.rotatedFilesToKeep).c_str());
+    for (int i = options_.rotatedFilesToKeep - 1; i >= 1; --i) {
+        std::rename(rotatedName(filename_, i).c_str(),
+                    rotatedName(filename_, i + 1).c_str());
+    }
+    if (options_.rotatedFilesToKeep > 0) {
+        std::rename(filename_.c_str(), rotatedName(filename_, 1).c_str());
+    } else {
+        std::remove(filename_.c_str());
+    }
+}
+
+void TelemetryLogWriter::writerLoop() {
+    std::vector<TelemetryRecord> batch;
+    batch.reserve(256);
+
+    auto lastSync = std::chrono::steady_clock::now();
+    bool unsynced = false;
+
+    while (true) {
+        bool stopping = shouldStop_.load(std::memory_order_acquire);
+
+        batch.clear();
+        TelemetryRecord record;
+        while (batch.size() < batch.capacity() && queue_.tryPop(record)) {
+            batch.push_back(record);
+        }
+
+        if (!batch.empty()) {
+            std::size_t bytes = batch.size() * sizeof(TelemetryRecord);
+            if (::write(fd_, batch.data(), bytes) == static_cast<ssize_t>(bytes)) {
+                segmentBytes_ += bytes;
+                recordsWritten_.fetch_add(batch.size(), std::memory_order_relaxed);
+                unsynced = true;
+            }
+
+            if (segmentBytes_ >= options_.maxFileBytes) {
+                ::fsync(fd_);
+                ::close(fd_);
+                unsynced = false;
+                rotateSegments();
+                if (!openSegment()) {
+                    // Disk trouble: stop logging rather than training
+                    fd_ = -1;
+                    open_.store(false, std::memory_order_release);
+                    return;
+                }
+            }
+            continue;        // Keep draining while records are queued
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        if (unsynced &&
+            now - lastSync >= std::chrono::milliseconds(options_.fsyncIntervalMs)) {
+            ::fsync(fd_);
+            lastSync = now;
+            unsynced = false;
+        }
+
+        if (stopping) {
+            break;        // Queue drained after the stop flag: done
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    if (unsynced) {
+        ::fsync(fd_);
+    }
+}
+
+bool exportCsv(const std::string& logFile, const std::string& csvFile) {
+    std::ifstream in(logFile, std::ios::binary);
+    if (!in.is_open()) {
+        return false;
+    }
+
+    FileHeader header{};
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!in ||
+        std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        header.version != VERSION ||
+        header.recordSize != sizeof(TelemetryRecord)) {
+        return false;
+    }
+
+    std::ofstream out(csvFile);
+    if (!out.is_open()) {
+        return false;
+    }
+
+    out << "iteration,elapsed_ms,nodes,iter_per_sec,mae";
+    for (int player = 0; player < aof::GameConfig::NUM_PLAYERS; ++player) {
+        out << ",utility_" << player;
+    }
+    out << "\n";
+    out.precision(12);
+
+    TelemetryRecord record;
+    while (in.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+        out << record.iteration << ',' << record.elapsedMs << ','
+            << record.nodeCount << ',' << record.iterationsPerSecond << ','
+            << record.meanAbsoluteError;
+        for (int player = 0; player < aof::GameConfig::NUM_PLAYERS; ++player) {
+            out << ',' << record.playerUtilities[player];
+        }
+        out << "\n";
+    }
+
+    // A trailing partial record (crash mid-append) is expected and simply
+    // dropped; any other state is a real read error
+    return in.eof();
+}
+
+} // namespace telemetry_log
+} // namespace mccfr
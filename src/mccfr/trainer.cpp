@@ -1,5 +1,11 @@
 #include "mccfr/trainer.hpp"
+#include "mccfr/distributed_sync.hpp"
+#include "mccfr/strategy_file_format.hpp"
+#include "mccfr/strategy_manager.hpp"
+#include "mccfr/strategy_kernels.hpp"
 #include "mccfr/utils.hpp"
+#include "mccfr/info_set_key.hpp"
+#include "mccfr/telemetry_log.hpp"
 #include "aof/game_config.hpp"
 #include <iostream>
 #include <iomanip>
@@ -8,10 +14,34 @@
 #include <algorithm>
 #include <cmath>
 #include <filesystem>
+#include <thread>
+#include <atomic>
+#include <deque>
+#include <cstdio>
+#include <cstring>
 
 namespace mccfr {
 
-Trainer::Trainer(const aof::Game& game) 
+namespace {
+
+/// Per-iteration node update parameters, including whether regret-based
+/// pruning is active this iteration (off during warmup and on the
+/// periodic re-exploration iterations so pruned branches can recover)
+UpdatePolicy makeUpdatePolicy(const TrainingConfig& config, int iteration) {
+    UpdatePolicy policy{config.updateRule, iteration,
+                        config.dcfrAlpha, config.dcfrBeta, config.dcfrGamma};
+    policy.pruneEnabled = config.enablePruning &&
+        config.samplingScheme == SamplingScheme::EXTERNAL &&
+        iteration > config.pruningWarmupIterations &&
+        (config.pruningRestoreInterval <= 0 ||
+         iteration % config.pruningRestoreInterval != 0);
+    policy.pruneThreshold = config.pruningThreshold;
+    return policy;
+}
+
+} // namespace
+
+Trainer::Trainer(const aof::Game& game)
     : game_(game)
     , nodeMap_()
     , stats_{}
@@ -20,14 +50,19 @@ Trainer::Trainer(const aof::Game& game)
 }
 
 aof::PlayerUtilities Trainer::train(const TrainingConfig& config) {
-    std::cout << "Starting MCCFR training with " << config.iterations << " iterations...\n";
-    
+    if (config.numThreads > 1) {
+        return trainParallel(config);
+    }
+
+    if (config.enableProgressOutput) {
+        std::cout << "Starting MCCFR training with " << config.iterations
+                  << " iterations...\n";
+    }
+
     auto startTime = std::chrono::steady_clock::now();
-    stats_.totalIterations = 0;
-    
-    aof::PlayerUtilities totalUtilities(aof::GameConfig::NUM_PLAYERS, 0.0);
+
     aof::PlayerUtilities avgUtilities(aof::GameConfig::NUM_PLAYERS, 0.0);
-    
+
     // Initialize real-time visualizer
     if (config.realtimeConfig.enabled) {
         visualizer_ = std::make_unique<RealtimeVisualizer>(config.realtimeConfig);
@@ -37,101 +72,359 @@ aof::PlayerUtilities Trainer::train(const TrainingConfig& config) {
         }
     }
     
-    // CSV logging removed - using direct real-time visualization only
-    
-    for (int iteration = 1; iteration <= config.iterations; ++iteration) {
-        // Create a single game state for all players to ensure zero-sum utilities
-        auto baseState = game_.createInitialState();
-        std::vector<double> baseReachProb(aof::GameConfig::NUM_PLAYERS, 1.0);
-        
-        // Train each player using MCCFR (this updates strategies)
-        std::vector<double> mccfrUtilities(aof::GameConfig::NUM_PLAYERS, 0.0);
-        for (int player = 0; player < aof::GameConfig::NUM_PLAYERS; ++player) {
-            auto stateCopy = std::make_unique<aof::GameState>(*baseState);
-            std::vector<double> reachProb = baseReachProb;
-            
-            mccfrUtilities[player] = mccfr(std::move(stateCopy), player, reachProb);
+    // Durable telemetry log: the realtime visualizer's data dies with the
+    // process, this keeps a rotated on-disk record of the convergence curve
+    std::unique_ptr<telemetry_log::TelemetryLogWriter> telemetryLog;
+    if (config.enableDataLogging && !config.dataLogFile.empty()) {
+        telemetry_log::TelemetryLogWriter::Options logOptions;
+        logOptions.maxFileBytes = config.dataLogMaxBytes;
+        logOptions.rotatedFilesToKeep = config.dataLogFilesToKeep;
+        telemetryLog = std::make_unique<telemetry_log::TelemetryLogWriter>();
+        if (!telemetryLog->open(config.dataLogFile, logOptions)) {
+            std::cerr << "Warning: could not open telemetry log "
+                      << config.dataLogFile << "\n";
+            telemetryLog.reset();
         }
-        
-        // For utility tracking, use exact utilities from a single terminal outcome
-        // This ensures perfect zero-sum property for display purposes
-        auto terminalState = std::make_unique<aof::GameState>(*baseState);
-        auto exactUtilities = getExactUtilities(std::move(terminalState));
-        
-        // Accumulate the exact utilities for averaging
-        for (int player = 0; player < aof::GameConfig::NUM_PLAYERS; ++player) {
-            totalUtilities[player] += exactUtilities[player];
-            avgUtilities[player] = totalUtilities[player] / iteration;
+    }
+
+    // Background checkpoint writer state: the training thread only pays
+    // for the node map snapshot, the file write happens off-thread
+    std::thread checkpointWriter;
+    std::deque<std::string> checkpointFiles;
+
+    std::unique_ptr<DistributedSync> distributedSync;
+    if (!config.syncDirectory.empty()) {
+        distributedSync = std::make_unique<DistributedSync>(config.syncDirectory,
+                                                            config.syncWorkerId);
+    }
+
+    // One PRNG seeded per run drives every deal; an explicit rngSeed also
+    // reseeds the sampling RNG so the whole run replays exactly
+    if (!resumePending_) {
+        masterSeed_ = (config.rngSeed != 0)
+            ? config.rngSeed : std::random_device{}();
+        cumulativeUtilities_.assign(aof::GameConfig::NUM_PLAYERS, 0.0);
+    }
+    aof::FastRng dealRng(masterSeed_);
+
+    stats_.peakNodeMapBytes = nodeMap_.memoryBytes();
+    stats_.spilledNodes = 0;
+    spillFile_.clear();
+    if (config.memoryBudgetBytes > 0) {
+        // A stale spill file from an earlier run must not merge into this one
+        std::remove((config.outputPrefix + "_spill.bin").c_str());
+    }
+
+    int startIteration = 1;
+    if (resumePending_) {
+        // Continue a loaded checkpoint: replay the deal stream up to the
+        // checkpointed iteration (one draw each) and put the sampling RNG
+        // back where it was, so the run proceeds bit-for-bit as if it had
+        // never stopped
+        startIteration = resumeIteration_ + 1;
+        for (int i = 0; i < resumeIteration_; ++i) {
+            dealRng.next();
         }
-        
-        stats_.totalIterations = iteration;
-        
-        // Update progress
-        if (config.enableProgressOutput && 
-            (iteration % config.progressUpdateInterval == 0 || iteration == config.iterations)) {
-            updateProgress(iteration, config.iterations, startTime, config);
+        if (!resumeSamplingRng_.empty()) {
+            utils::restoreThreadRngState(resumeSamplingRng_);
         }
-        
-        // Update utility statistics
-        if (config.enableUtilityTracking && 
-            (iteration % config.utilityUpdateInterval == 0 || iteration == config.iterations)) {
-            double variance = config.showUtilityVariance ? calculateUtilityVariance(avgUtilities) : 0.0;
-            printUtilityStats(avgUtilities, iteration, variance);
-            
-            // Verify utilities sum to zero (within numerical precision)
-            double utilitySum = 0.0;
-            for (double utility : avgUtilities) {
-                utilitySum += utility;
-            }
-            if (std::abs(utilitySum) > 1e-10) {
-                std::cout << "WARNING: Utilities don't sum to zero! Sum = " 
-                          << std::fixed << std::setprecision(16) << utilitySum << "\n";
-            } else {
-                std::cout << "✓ Utilities sum to zero (sum = " 
-                          << std::scientific << std::setprecision(3) << utilitySum << ")\n";
+        resumePending_ = false;
+        if (config.enableProgressOutput) {
+            std::cout << "Resuming from iteration " << resumeIteration_ << "\n";
+        }
+    } else if (config.rngSeed != 0) {
+        utils::seedThreadRng(masterSeed_);
+    }
+
+    stats_.totalIterations = startIteration - 1;
+    for (int player = 0; player < aof::GameConfig::NUM_PLAYERS; ++player) {
+        avgUtilities[player] = cumulativeUtilities_[player] /
+                               std::max(1, startIteration - 1);
+    }
+
+    // Warm-start seeding only applies to nodes created by the training
+    // loop itself; the hook is removed before the spill merge below so
+    // respawned nodes are not seeded a second time
+    nodeMap_.setNodeInitializer(makeWarmStartInitializer());
+
+    const int batchSize = std::max(1, config.batchSize);
+    std::vector<std::unique_ptr<aof::GameState>> batchStates;
+    std::vector<aof::PlayerUtilities> batchUtilities;
+    batchStates.reserve(batchSize);
+    batchUtilities.reserve(batchSize);
+
+    bool stopEarly = false;
+    for (int batchStart = startIteration;
+         batchStart <= config.iterations && !stopEarly;
+         batchStart += batchSize) {
+        int batchCount = std::min(batchSize, config.iterations - batchStart + 1);
+        int batchEnd = batchStart + batchCount - 1;
+
+        // Stage 1: deal every hand in the batch up front, one seed per
+        // iteration so the deal stream stays aligned with checkpoint
+        // accounting regardless of the batch size
+        batchStates.clear();
+        for (int k = 0; k < batchCount; ++k) {
+            batchStates.push_back(game_.createInitialState(dealRng.next()));
+        }
+
+        // Stage 2: traverse each deal in iteration order. The undo-based
+        // traversal restores the state fully between players, so all four
+        // traversals see the same deal without cloning it.
+        {
+            AOF_PROF_TIMER(traversalTimer, TRAVERSAL);
+            for (int k = 0; k < batchCount; ++k) {
+                UpdatePolicy policy = makeUpdatePolicy(config, batchStart + k);
+                ReachProbs reachProb;
+                for (int player = 0; player < aof::GameConfig::NUM_PLAYERS; ++player) {
+                    if (config.samplingScheme == SamplingScheme::OUTCOME) {
+                        double tailProb = 0.0;
+                        mccfrOutcome(*batchStates[k], player, 1.0, 1.0, 1.0,
+                                     config.explorationEpsilon, policy,
+                                     tailProb);
+                    } else {
+                        reachProb.fill(1.0);
+                        mccfr(*batchStates[k], player, reachProb, policy);
+                    }
+                }
             }
         }
-        
-        // Send data to real-time visualizer
-        if (visualizer_ && visualizer_->isRunning() && 
-            (iteration % config.realtimeConfig.updateInterval == 0 || iteration == config.iterations)) {
-            
-            double meanAbsoluteError = calculateUtilityVariance(avgUtilities);
-            double utilitySum = 0.0;
-            for (double utility : avgUtilities) {
-                utilitySum += utility;
+
+        // Stage 3: exact terminal utilities (display/tracking only) for
+        // the whole batch together, so the grouped showdown walks reuse
+        // the strategy and evaluator state the traversals just touched
+        batchUtilities.clear();
+        {
+            AOF_PROF_TIMER(terminalTimer, TERMINAL_EVAL);
+            for (int k = 0; k < batchCount; ++k) {
+                auto terminalState =
+                    std::make_unique<aof::GameState>(*batchStates[k]);
+                batchUtilities.push_back(getExactUtilities(std::move(terminalState)));
             }
-            
-            auto currentTime = std::chrono::steady_clock::now();
-            auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(currentTime - startTime).count();
-            
-            TrainingDataPoint dataPoint(
-                iteration, 
-                meanAbsoluteError, 
-                utilitySum, 
-                avgUtilities,
-                std::chrono::milliseconds(elapsedMs)
-            );
-            visualizer_->addDataPoint(dataPoint);
         }
-        
-        // Custom progress callback
-        if (config.progressCallback) {
-            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-                std::chrono::steady_clock::now() - startTime);
-            config.progressCallback(iteration, config.iterations, elapsed);
+
+        // Stage 4: per-iteration bookkeeping, in iteration order
+        for (int k = 0; k < batchCount; ++k) {
+            int iteration = batchStart + k;
+
+            // Accumulate the exact utilities for averaging
+            for (int player = 0; player < aof::GameConfig::NUM_PLAYERS; ++player) {
+                cumulativeUtilities_[player] += batchUtilities[k][player];
+                avgUtilities[player] = cumulativeUtilities_[player] / iteration;
+            }
+
+            stats_.totalIterations = iteration;
+
+            // Update progress
+            if (config.enableProgressOutput &&
+                (iteration % config.progressUpdateInterval == 0 || iteration == config.iterations)) {
+                updateProgress(iteration, config.iterations, startTime, config);
+            }
+
+            // Update utility statistics
+            if (config.enableUtilityTracking &&
+                (iteration % config.utilityUpdateInterval == 0 || iteration == config.iterations)) {
+                double variance = config.showUtilityVariance ? calculateUtilityVariance(avgUtilities) : 0.0;
+                printUtilityStats(avgUtilities, iteration, variance);
+
+                // Verify utilities sum to zero (within numerical precision)
+                double utilitySum = 0.0;
+                for (double utility : avgUtilities) {
+                    utilitySum += utility;
+                }
+                if (std::abs(utilitySum) > 1e-10) {
+                    std::cout << "WARNING: Utilities don't sum to zero! Sum = "
+                              << std::fixed << std::setprecision(16) << utilitySum << "\n";
+                } else {
+                    std::cout << "✓ Utilities sum to zero (sum = "
+                              << std::scientific << std::setprecision(3) << utilitySum << ")\n";
+                }
+            }
+
+            // Send data to real-time visualizer
+            if (visualizer_ && visualizer_->isRunning() &&
+                (iteration % config.realtimeConfig.updateInterval == 0 || iteration == config.iterations)) {
+
+                double meanAbsoluteError = calculateUtilityVariance(avgUtilities);
+                double utilitySum = 0.0;
+                for (double utility : avgUtilities) {
+                    utilitySum += utility;
+                }
+
+                auto currentTime = std::chrono::steady_clock::now();
+                auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(currentTime - startTime).count();
+
+                TrainingDataPoint dataPoint(
+                    iteration,
+                    meanAbsoluteError,
+                    utilitySum,
+                    avgUtilities,
+                    std::chrono::milliseconds(elapsedMs)
+                );
+                visualizer_->addDataPoint(dataPoint);
+            }
+
+            // Append a telemetry record; one struct copy on this thread,
+            // the background writer handles buffering, fsync and rotation
+            if (telemetryLog &&
+                (iteration % config.dataLogInterval == 0 || iteration == config.iterations)) {
+                auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - startTime).count();
+
+                telemetry_log::TelemetryRecord record;
+                record.iteration = iteration;
+                record.elapsedMs = elapsedMs;
+                record.nodeCount = nodeMap_.size();
+                record.iterationsPerSecond = elapsedMs > 0
+                    ? (iteration - startIteration + 1) * 1000.0 / elapsedMs
+                    : 0.0;
+                record.meanAbsoluteError = calculateUtilityVariance(avgUtilities);
+                for (int player = 0; player < aof::GameConfig::NUM_PLAYERS; ++player) {
+                    record.playerUtilities[player] = avgUtilities[player];
+                }
+                telemetryLog->append(record);
+            }
+
+            // Custom progress callback
+            if (config.progressCallback) {
+                auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - startTime);
+                config.progressCallback(iteration, config.iterations, elapsed);
+            }
+        }
+
+        // Node-map-dependent periodic work runs on batch boundaries only,
+        // so a checkpoint never captures regret updates from iterations
+        // it does not account for. With batchSize == 1 every iteration is
+        // a boundary and the schedule is the per-iteration one.
+        int iteration = batchEnd;
+        auto intervalCrossed = [&](int interval) {
+            return interval > 0 &&
+                   iteration / interval > (batchStart - 1) / interval;
+        };
+
+        // Exchange regret deltas with the other distributed workers
+        if (distributedSync && intervalCrossed(config.syncInterval)) {
+            distributedSync->publishDelta(nodeMap_);
+            distributedSync->mergeRemoteDeltas(nodeMap_);
+        }
+
+        // Periodic asynchronous checkpoint (the final save below covers
+        // the last iteration)
+        if (intervalCrossed(config.checkpointInterval) &&
+            iteration < config.iterations) {
+
+            // A lagging writer bounds us to one in-flight checkpoint
+            if (checkpointWriter.joinable()) {
+                checkpointWriter.join();
+            }
+
+            auto snapshot = std::make_shared<FlatNodeMap>(nodeMap_);
+
+            std::string checkpointFile = config.outputPrefix + "_checkpoint_" +
+                                         std::to_string(iteration) + ".txt";
+            checkpointFiles.push_back(checkpointFile);
+
+            std::string staleFile;
+            if (config.checkpointsToKeep > 0 &&
+                checkpointFiles.size() > static_cast<std::size_t>(config.checkpointsToKeep)) {
+                staleFile = checkpointFiles.front();
+                checkpointFiles.pop_front();
+            }
+
+            // Capture the resume state on the training thread (the
+            // sampling RNG is thread-local) before handing off to the writer
+            std::string resumeFile = config.outputPrefix + "_resume.ckpt";
+            std::uint64_t resumeSeed = masterSeed_;
+            auto resumeUtilities = cumulativeUtilities_;
+            std::string samplingState = utils::saveThreadRngState();
+
+            checkpointWriter = std::thread(
+                [this, snapshot, checkpointFile, staleFile, iteration,
+                 resumeFile, resumeSeed, resumeUtilities, samplingState]() {
+                    writeStrategies(*snapshot, checkpointFile, true, iteration);
+                    writeCheckpoint(*snapshot, resumeFile, iteration, resumeSeed,
+                                    resumeUtilities, samplingState);
+                    if (!staleFile.empty()) {
+                        std::remove(staleFile.c_str());
+                    }
+                });
+        }
+
+        // Periodic exploitability check with an optional early stop once
+        // the profile is measurably close to equilibrium
+        if (intervalCrossed(config.exploitabilityInterval)) {
+            unsigned hardwareThreads = std::thread::hardware_concurrency();
+            auto result = computeExploitability(
+                config.exploitabilityDeals,
+                hardwareThreads > 0 ? static_cast<int>(hardwareThreads) : 1);
+            if (config.enableProgressOutput) {
+                std::cout << "\nExploitability at iteration " << iteration
+                          << ": " << std::fixed << std::setprecision(6)
+                          << result.exploitability << " chips/hand\n";
+            }
+            if (config.exploitabilityThreshold > 0.0 &&
+                result.exploitability <= config.exploitabilityThreshold) {
+                if (config.enableProgressOutput) {
+                    std::cout << "Exploitability below threshold "
+                              << config.exploitabilityThreshold
+                              << ", stopping early\n";
+                }
+                stopEarly = true;
+            }
+        }
+
+        // Keep the node map inside the configured memory budget
+        if (config.memoryBudgetBytes > 0) {
+            enforceMemoryBudget(config);
         }
     }
-    
+
+    // Make sure the last checkpoint finished before the final save
+    if (checkpointWriter.joinable()) {
+        checkpointWriter.join();
+    }
+
+    // The training loop is done: stop warm-start seeding so the merges
+    // below land on unseeded fresh nodes
+    nodeMap_.setNodeInitializer({});
+
+    // Publish whatever the final iterations accumulated and pick up any
+    // last deltas from the other workers before saving
+    if (distributedSync) {
+        distributedSync->publishDelta(nodeMap_);
+        distributedSync->mergeRemoteDeltas(nodeMap_);
+    }
+
+    // Fold spilled nodes back in so the final map and save hold the
+    // exact sums (the merge may take the map back over the budget; it
+    // only has to fit for as long as the save runs)
+    if (!spillFile_.empty()) {
+        if (!mergeSpillFile(spillFile_)) {
+            std::cerr << "Warning: could not merge spill file " << spillFile_
+                      << "; the saved strategies miss the spilled nodes\n";
+        }
+        std::remove(spillFile_.c_str());
+        spillFile_.clear();
+    }
+
     auto endTime = std::chrono::steady_clock::now();
     stats_.totalTime = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
     stats_.informationSetsCount = nodeMap_.size();
     stats_.finalUtilities = avgUtilities;
-    
+    writeProfileReport(config);
+
     if (config.enableProgressOutput) {
         std::cout << "\n\nTraining completed!\n";
         std::cout << "Total time: " << formatDuration(stats_.totalTime) << "\n";
         std::cout << "Information sets learned: " << nodeMap_.size() << "\n";
+        if (config.memoryBudgetBytes > 0) {
+            std::cout << "Peak node-map memory: "
+                      << (stats_.peakNodeMapBytes + 1023) / 1024
+                      << " KB (budget "
+                      << (config.memoryBudgetBytes + 1023) / 1024
+                      << " KB), nodes spilled: " << stats_.spilledNodes << "\n";
+        }
         std::cout << "Final average utilities: [";
         for (std::size_t i = 0; i < avgUtilities.size(); ++i) {
             if (i > 0) std::cout << ", ";
@@ -168,8 +461,12 @@ aof::PlayerUtilities Trainer::train(const TrainingConfig& config) {
     
     saveStrategies(filename.str());
     
-    // No CSV files to close - using direct real-time visualization only
-    
+    // Drain and sync the telemetry log so the tail of the run is durable
+    if (telemetryLog) {
+        telemetryLog->close();
+    }
+
+
     // Stop real-time visualizer
     if (visualizer_) {
         std::cout << "Training complete! Real-time visualizer will continue running.\n";
@@ -181,59 +478,104 @@ aof::PlayerUtilities Trainer::train(const TrainingConfig& config) {
 }
 
 std::vector<double> Trainer::getStrategy(const std::string& infoSet) const {
-    auto it = nodeMap_.find(infoSet);
-    if (it != nodeMap_.end()) {
-        return it->second.getAverageStrategy();
+    InfoSetKey key = 0;
+    if (!utils::parseInfoSetString(infoSet, key)) {
+        return {};
     }
-    return {};
+
+    const Node* node = nodeMap_.find(key);
+    return node ? node->getAverageStrategy() : std::vector<double>();
 }
 
 std::unordered_map<std::string, std::vector<double>> Trainer::getAllStrategies() const {
+    // Gather sums densely and normalize the whole map in one kernel pass
+    std::vector<InfoSetKey> keys;
+    std::vector<double> rows;
+    keys.reserve(nodeMap_.size());
+    rows.reserve(nodeMap_.size() * 2);
+
+    int numActions = 0;
+    nodeMap_.forEach([&](InfoSetKey key, const Node& node) {
+        if (numActions == 0) {
+            numActions = node.numActions();
+        } else if (node.numActions() != numActions) {
+            throw std::runtime_error("Mixed node widths in strategy export");
+        }
+        keys.push_back(key);
+        rows.insert(rows.end(), node.getStrategySum().data(),
+                    node.getStrategySum().data() + numActions);
+    });
+    kernels::averageStrategyRows(rows.data(), keys.size(), numActions);
+
     std::unordered_map<std::string, std::vector<double>> strategies;
-    
-    for (const auto& [infoSet, node] : nodeMap_) {
-        strategies[infoSet] = node.getAverageStrategy();
+    strategies.reserve(keys.size());
+    for (std::size_t n = 0; n < keys.size(); ++n) {
+        const double* row = rows.data() + n * numActions;
+        strategies[utils::decodeInfoSetString(keys[n])] =
+            std::vector<double>(row, row + numActions);
     }
-    
     return strategies;
 }
 
 void Trainer::saveStrategies(const std::string& filename, bool includeVisitCounts) const {
+    writeStrategies(nodeMap_, filename, includeVisitCounts, stats_.totalIterations);
+}
+
+void Trainer::writeStrategies(const FlatNodeMap& nodes,
+                             const std::string& filename,
+                             bool includeVisitCounts,
+                             int totalIterations) const {
     std::ofstream file(filename);
     if (!file.is_open()) {
         std::cerr << "Error: Unable to open file for writing: " << filename << "\n";
         return;
     }
-    
+
     // Write header
     file << "# MCCFR Strategy File\n";
-    file << "# Generated with " << stats_.totalIterations << " iterations\n";
-    file << "# Total information sets: " << nodeMap_.size() << "\n";
+    file << "# Generated with " << totalIterations << " iterations\n";
+    file << "# Total information sets: " << nodes.size() << "\n";
     file << "# Format: InfoSet: <infoset_string> Visits: <count>\n";
     file << "#         Strategy: <prob1> <prob2> ...\n\n";
-    
+
     // Sort information sets by visit count for better readability
     std::vector<std::pair<std::string, const Node*>> sortedNodes;
-    for (const auto& [infoSet, node] : nodeMap_) {
-        sortedNodes.emplace_back(infoSet, &node);
-    }
+    sortedNodes.reserve(nodes.size());
+    nodes.forEach([&sortedNodes](InfoSetKey key, const Node& node) {
+        sortedNodes.emplace_back(utils::decodeInfoSetString(key), &node);
+    });
     
     std::sort(sortedNodes.begin(), sortedNodes.end(),
               [](const auto& a, const auto& b) {
                   return a.second->getVisitCount() > b.second->getVisitCount();
               });
-    
+
+    // Normalize every node's average strategy in one batched kernel pass
+    // instead of node by node (AoF nodes all share one action count)
+    int numActions = sortedNodes.empty() ? 0 : sortedNodes.front().second->numActions();
+    std::vector<double> rows(sortedNodes.size() * numActions);
+    for (std::size_t n = 0; n < sortedNodes.size(); ++n) {
+        const Node* node = sortedNodes[n].second;
+        if (node->numActions() != numActions) {
+            throw std::runtime_error("Mixed node widths in strategy export");
+        }
+        std::copy_n(node->getStrategySum().data(), numActions,
+                    rows.data() + n * numActions);
+    }
+    kernels::averageStrategyRows(rows.data(), sortedNodes.size(), numActions);
+
     // Write strategies
-    for (const auto& [infoSet, node] : sortedNodes) {
+    for (std::size_t n = 0; n < sortedNodes.size(); ++n) {
+        const auto& [infoSet, node] = sortedNodes[n];
         file << "InfoSet: " << infoSet;
         if (includeVisitCounts) {
             file << " Visits: " << node->getVisitCount();
         }
         file << "\n";
-        
-        auto avgStrategy = node->getAverageStrategy();
+
+        const double* avgStrategy = rows.data() + n * numActions;
         file << "Strategy: ";
-        for (std::size_t i = 0; i < avgStrategy.size(); ++i) {
+        for (int i = 0; i < numActions; ++i) {
             if (i > 0) file << " ";
             file << std::fixed << std::setprecision(16) << avgStrategy[i];
         }
@@ -295,15 +637,16 @@ bool Trainer::loadStrategies(const std::string& filename) {
                 strategy.push_back(prob);
             }
             
-            if (!strategy.empty()) {
-                Node node(strategy.size());
-                // We can't perfectly reconstruct the internal state, but we can
-                // set the strategy sum to approximate the learned strategy
+            InfoSetKey key = 0;
+            if (!strategy.empty() && utils::parseInfoSetString(infoSet, key)) {
+                Node& node = nodeMap_.getOrCreate(key, static_cast<int>(strategy.size()));
+                // Strategy files only keep the normalized averages, so the
+                // internal sums are approximated here; use loadCheckpoint
+                // for an exact reconstruction
                 for (std::size_t i = 0; i < strategy.size(); ++i) {
                     // Approximate reconstruction
                     node.updateRegret(i, strategy[i] * visits);
                 }
-                nodeMap_[infoSet] = std::move(node);
             }
         }
     }
@@ -313,121 +656,1251 @@ bool Trainer::loadStrategies(const std::string& filename) {
     return true;
 }
 
-void Trainer::reset() {
+bool Trainer::saveCheckpoint(const std::string& filename) const {
+    return writeCheckpoint(nodeMap_, filename, stats_.totalIterations,
+                           masterSeed_, cumulativeUtilities_,
+                           utils::saveThreadRngState());
+}
+
+bool Trainer::writeCheckpoint(const FlatNodeMap& nodes,
+                             const std::string& filename,
+                             int completedIterations,
+                             std::uint64_t masterSeed,
+                             const aof::PlayerUtilities& utilities,
+                             const std::string& samplingRngState) const {
+    std::string tempPath = filename + ".tmp";
+    std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "Error: Unable to open checkpoint file for writing: "
+                  << filename << "\n";
+        return false;
+    }
+
+    // The file stores one action count; mixed node widths are not
+    // expected in AoF (decision nodes are all FOLD/ALL_IN)
+    std::uint32_t numActions = 0;
+    std::uint64_t entryCount = 0;
+    nodes.forEach([&](InfoSetKey, const Node& node) {
+        if (numActions == 0) {
+            numActions = static_cast<std::uint32_t>(node.numActions());
+        }
+        if (numActions == static_cast<std::uint32_t>(node.numActions())) {
+            ++entryCount;
+        }
+    });
+
+    strategy_file::ResumeState resume{};
+    resume.completedIterations = static_cast<std::uint64_t>(completedIterations);
+    resume.masterSeed = masterSeed;
+    resume.numPlayers = static_cast<std::uint32_t>(utilities.size());
+    resume.samplingRngBytes = static_cast<std::uint32_t>(samplingRngState.size());
+
+    strategy_file::Header header{};
+    std::memcpy(header.magic, strategy_file::CHECKPOINT_MAGIC, sizeof(header.magic));
+    header.version = strategy_file::CHECKPOINT_VERSION;
+    header.numActions = numActions;
+    header.entryCount = entryCount;
+    header.slotCount = 0;
+    header.indexOffset = 0;
+    header.entriesOffset = sizeof(header) + sizeof(resume) +
+                           resume.numPlayers * sizeof(double) +
+                           resume.samplingRngBytes;
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(&resume), sizeof(resume));
+    file.write(reinterpret_cast<const char*>(utilities.data()),
+               resume.numPlayers * sizeof(double));
+    file.write(samplingRngState.data(), resume.samplingRngBytes);
+
+    nodes.forEach([&](InfoSetKey key, const Node& node) {
+        if (static_cast<std::uint32_t>(node.numActions()) != numActions) {
+            std::cerr << "Warning: skipping checkpoint entry with "
+                      << node.numActions() << " actions (file uses "
+                      << numActions << ")\n";
+            return;
+        }
+        strategy_file::EntryHeader entryHeader{key, node.getVisitCount()};
+        file.write(reinterpret_cast<const char*>(&entryHeader), sizeof(entryHeader));
+        file.write(reinterpret_cast<const char*>(node.getRegretSum().data()),
+                   numActions * sizeof(double));
+        file.write(reinterpret_cast<const char*>(node.getStrategySum().data()),
+                   numActions * sizeof(double));
+    });
+
+    file.close();
+    if (!file.good() || std::rename(tempPath.c_str(), filename.c_str()) != 0) {
+        std::remove(tempPath.c_str());
+        std::cerr << "Error occurred while writing checkpoint: " << filename << "\n";
+        return false;
+    }
+    return true;
+}
+
+bool Trainer::loadCheckpoint(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Error: Unable to open checkpoint file for reading: "
+                  << filename << "\n";
+        return false;
+    }
+
+    strategy_file::Header header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file.good() ||
+        std::memcmp(header.magic, strategy_file::CHECKPOINT_MAGIC,
+                    sizeof(header.magic)) != 0 ||
+        header.version != strategy_file::CHECKPOINT_VERSION) {
+        std::cerr << "Error: Not a training checkpoint file: " << filename << "\n";
+        return false;
+    }
+
+    strategy_file::ResumeState resume{};
+    file.read(reinterpret_cast<char*>(&resume), sizeof(resume));
+
+    aof::PlayerUtilities utilities(resume.numPlayers, 0.0);
+    file.read(reinterpret_cast<char*>(utilities.data()),
+              resume.numPlayers * sizeof(double));
+    utilities.resize(aof::GameConfig::NUM_PLAYERS, 0.0);
+
+    std::string samplingState(resume.samplingRngBytes, '\0');
+    file.read(samplingState.empty() ? nullptr : &samplingState[0],
+              resume.samplingRngBytes);
+
     nodeMap_.clear();
+    nodeMap_.reserve(header.entryCount);
+
+    // Fresh nodes are zero-initialized, so accumulating the stored sums
+    // reproduces every node exactly
+    std::array<double, Node::MAX_ACTIONS> regretSum;
+    std::array<double, Node::MAX_ACTIONS> strategySum;
+    for (std::uint64_t n = 0; n < header.entryCount; ++n) {
+        strategy_file::EntryHeader entryHeader{};
+        file.read(reinterpret_cast<char*>(&entryHeader), sizeof(entryHeader));
+        file.read(reinterpret_cast<char*>(regretSum.data()),
+                  header.numActions * sizeof(double));
+        file.read(reinterpret_cast<char*>(strategySum.data()),
+                  header.numActions * sizeof(double));
+        if (!file.good()) {
+            std::cerr << "Error: Truncated checkpoint file: " << filename << "\n";
+            nodeMap_.clear();
+            return false;
+        }
+
+        Node& node = nodeMap_.getOrCreate(entryHeader.key,
+                                          static_cast<int>(header.numActions));
+        node.accumulate(regretSum.data(), strategySum.data(),
+                        entryHeader.visitCount);
+    }
+
     stats_ = TrainingStats{};
+    stats_.totalIterations = static_cast<int>(resume.completedIterations);
+    stats_.informationSetsCount = nodeMap_.size();
+    masterSeed_ = resume.masterSeed;
+    cumulativeUtilities_ = utilities;
+    resumeSamplingRng_ = samplingState;
+    resumeIteration_ = static_cast<int>(resume.completedIterations);
+    resumePending_ = true;
+
+    std::cout << "Loaded checkpoint with " << nodeMap_.size()
+              << " information sets at iteration " << resumeIteration_
+              << " from: " << filename << "\n";
+    return true;
 }
 
-// Private methods
-double Trainer::mccfr(std::unique_ptr<aof::GameState> state, 
-                     int player, 
-                     std::vector<double>& reachProb) {
-    
-    if (state->isTerminal()) {
-        auto utilities = state->getReturns();
-        return utilities[player];
+bool Trainer::warmStart(const std::string& filename, double priorWeight) {
+    if (priorWeight <= 0.0) {
+        std::cerr << "Error: Warm-start prior weight must be positive\n";
+        return false;
     }
-    
-    if (state->isChanceNode()) {
-        state->applyAction(aof::Action::DEAL);
-        return mccfr(std::move(state), player, reachProb);
+
+    // Sniff the magic so both text and binary strategy files work
+    StrategyManager manager;
+    bool loaded = false;
+    {
+        std::ifstream probe(filename, std::ios::binary);
+        char magic[sizeof(strategy_file::MAGIC)] = {};
+        probe.read(magic, sizeof(magic));
+        bool binary = probe.good() &&
+            std::memcmp(magic, strategy_file::MAGIC, sizeof(magic)) == 0;
+        probe.close();
+        loaded = binary ? manager.loadFromBinary(filename)
+                        : manager.loadFromFile(filename);
     }
-    
-    int currentPlayer = state->getCurrentPlayer();
-    std::string infoSet = utils::getInformationSet(*state, currentPlayer);
-    
-    auto legalActions = state->getLegalActions();
-    if (legalActions.empty()) {
-        throw std::runtime_error("No legal actions available");
+    if (!loaded || manager.empty()) {
+        std::cerr << "Error: Unable to load warm-start strategies from: "
+                  << filename << "\n";
+        return false;
     }
-    
-    // Ensure node exists
-    if (nodeMap_.find(infoSet) == nodeMap_.end()) {
-        nodeMap_.emplace(infoSet, Node(legalActions.size()));
+
+    // Group the prior by the key fields that survive a configuration
+    // change (pot stripped); several pots collapsing onto one group
+    // contribute their visit-weighted average
+    const auto& visitCounts = manager.getVisitCounts();
+    std::unordered_map<InfoSetKey, std::array<double, Node::MAX_ACTIONS>> sums;
+    std::size_t skipped = 0;
+    for (const auto& [infoSet, strategy] : manager.getAllStrategies()) {
+        InfoSetKey key = 0;
+        if (strategy.empty() ||
+            strategy.size() > static_cast<std::size_t>(Node::MAX_ACTIONS) ||
+            !utils::parseInfoSetString(infoSet, key)) {
+            ++skipped;
+            continue;
+        }
+
+        auto visitIt = visitCounts.find(infoSet);
+        double weight = 1.0 + static_cast<double>(
+            visitIt != visitCounts.end() ? visitIt->second : 0);
+        auto& sum = sums[utils::keyStructure(key)];
+        for (std::size_t i = 0; i < strategy.size(); ++i) {
+            sum[i] += weight * strategy[i];
+        }
     }
-    
-    Node& node = nodeMap_[infoSet];
-    
-    if (currentPlayer == player) {
-        // Player being trained
-        auto strategy = node.getStrategy(reachProb[player]);
-        std::vector<double> utilities(legalActions.size(), 0.0);
-        double nodeUtility = 0.0;
-        
-        // Compute utilities for each action
-        for (std::size_t i = 0; i < legalActions.size(); ++i) {
-            auto nextState = std::make_unique<aof::GameState>(*state);
-            nextState->applyAction(legalActions[i]);
-            
-            std::vector<double> nextReachProb = reachProb;
-            nextReachProb[player] *= strategy[i];
-            
-            utilities[i] = mccfr(std::move(nextState), player, nextReachProb);
-            nodeUtility += strategy[i] * utilities[i];
+    if (skipped > 0) {
+        std::cerr << "Warning: " << skipped
+                  << " warm-start strategies could not be used\n";
+    }
+
+    warmStartPrior_.clear();
+    for (auto& [key, sum] : sums) {
+        double total = 0.0;
+        for (double value : sum) {
+            total += value;
         }
-        
-        // Update regrets
-        for (std::size_t i = 0; i < legalActions.size(); ++i) {
-            double regret = utilities[i] - nodeUtility;
-            node.updateRegret(i, regret);
+        if (total <= 0.0) {
+            continue;
         }
-        
-        return nodeUtility;
-        
-    } else {
-        // Opponent player - sample according to current strategy
-        auto strategy = node.getStrategy(reachProb[currentPlayer]);
-        int actionIndex = utils::sampleAction(strategy);
-        
-        std::vector<double> nextReachProb = reachProb;
-        nextReachProb[currentPlayer] *= strategy[actionIndex];
-        
-        state->applyAction(legalActions[actionIndex]);
-        return mccfr(std::move(state), player, nextReachProb);
+        for (double& value : sum) {
+            value /= total;
+        }
+        warmStartPrior_.emplace(key, sum);
     }
-}
+    warmStartWeight_ = priorWeight;
 
-void Trainer::updateProgress(int iteration, int totalIterations,
-                           std::chrono::steady_clock::time_point startTime,
-                           const TrainingConfig& /* config */) const {
-    
-    auto currentTime = std::chrono::steady_clock::now();
-    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(currentTime - startTime);
-    
-    double percentage = (static_cast<double>(iteration) / totalIterations) * 100.0;
-    
-    // Estimate remaining time
-    double avgTimePerIter = elapsed.count() / static_cast<double>(iteration);
-    int remainingIters = totalIterations - iteration;
-    auto estimatedRemaining = std::chrono::milliseconds(
-        static_cast<long long>(avgTimePerIter * remainingIters));
-    
-    std::cout << "\rIteration " << iteration << " (" 
-              << std::fixed << std::setprecision(2) << percentage 
-              << "% completed, ETA: " << formatDuration(estimatedRemaining) << ")" 
-              << std::flush;
+    std::cout << "Warm start: " << warmStartPrior_.size()
+              << " structured priors from " << manager.size()
+              << " strategies in: " << filename << "\n";
+    return !warmStartPrior_.empty();
 }
 
-std::string Trainer::formatDuration(std::chrono::milliseconds duration) const {
-    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(duration);
-    auto minutes = std::chrono::duration_cast<std::chrono::minutes>(seconds);
-    auto hours = std::chrono::duration_cast<std::chrono::hours>(minutes);
-    
-    std::stringstream ss;
-    
-    if (hours.count() > 0) {
-        ss << hours.count() << "h ";
-        minutes -= hours;
-    }
-    
-    if (minutes.count() > 0) {
-        ss << minutes.count() << "m ";
-        seconds -= minutes;
+FlatNodeMap::NodeInitializer Trainer::makeWarmStartInitializer() const {
+    if (warmStartPrior_.empty()) {
+        return {};
     }
-    
-    ss << seconds.count() << "s";
-    
-    return ss.str();
+
+    return [this](InfoSetKey key, Node& node) {
+        auto it = warmStartPrior_.find(utils::keyStructure(key));
+        if (it == warmStartPrior_.end()) {
+            return;
+        }
+
+        // Seed only the average-strategy mass; regrets stay zero so
+        // regret matching is free to move away from the prior
+        std::array<double, Node::MAX_ACTIONS> regretDelta{};
+        std::array<double, Node::MAX_ACTIONS> strategyDelta{};
+        for (int i = 0; i < node.numActions(); ++i) {
+            strategyDelta[i] = warmStartWeight_ * it->second[i];
+        }
+        node.accumulate(regretDelta.data(), strategyDelta.data(), 0);
+    };
+}
+
+void Trainer::enforceMemoryBudget(const TrainingConfig& config) {
+    std::size_t budgetBytes = config.memoryBudgetBytes;
+    if (nodeMap_.memoryBytes() > stats_.peakNodeMapBytes) {
+        stats_.peakNodeMapBytes = nodeMap_.memoryBytes();
+    }
+    if (nodeMap_.memoryBytes() <= budgetBytes || nodeMap_.empty()) {
+        return;
+    }
+
+    // Evict the cold half of the map: nodes at or below the median visit
+    // count are the least likely to be touched again soon
+    std::vector<std::uint64_t> visits;
+    visits.reserve(nodeMap_.size());
+    nodeMap_.forEach([&](InfoSetKey, const Node& node) {
+        visits.push_back(node.getVisitCount());
+    });
+    std::nth_element(visits.begin(), visits.begin() + visits.size() / 2,
+                     visits.end());
+    std::uint64_t threshold = visits[visits.size() / 2];
+
+    if (spillFile_.empty()) {
+        spillFile_ = config.outputPrefix + "_spill.bin";
+    }
+    std::ofstream file(spillFile_, std::ios::binary | std::ios::app);
+    if (!file.is_open()) {
+        std::cerr << "Warning: Unable to open spill file " << spillFile_
+                  << "; memory budget not enforced\n";
+        return;
+    }
+
+    // One segment per action width, in the regret-delta format that
+    // DistributedSync uses; mergeSpillFile() accumulates them back
+    for (int numActions = 1; numActions <= Node::MAX_ACTIONS; ++numActions) {
+        std::uint64_t entryCount = 0;
+        nodeMap_.forEach([&](InfoSetKey, const Node& node) {
+            if (node.numActions() == numActions &&
+                node.getVisitCount() <= threshold) {
+                ++entryCount;
+            }
+        });
+        if (entryCount == 0) {
+            continue;
+        }
+
+        strategy_file::Header header{};
+        std::memcpy(header.magic, strategy_file::REGRET_MAGIC,
+                    sizeof(header.magic));
+        header.version = strategy_file::REGRET_VERSION;
+        header.numActions = static_cast<std::uint32_t>(numActions);
+        header.entryCount = entryCount;
+        header.slotCount = 0;
+        header.indexOffset = 0;
+        header.entriesOffset = sizeof(header);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        nodeMap_.forEach([&](InfoSetKey key, const Node& node) {
+            if (node.numActions() != numActions ||
+                node.getVisitCount() > threshold) {
+                return;
+            }
+            strategy_file::EntryHeader entryHeader{key, node.getVisitCount()};
+            file.write(reinterpret_cast<const char*>(&entryHeader),
+                       sizeof(entryHeader));
+            file.write(reinterpret_cast<const char*>(node.getRegretSum().data()),
+                       numActions * sizeof(double));
+            file.write(reinterpret_cast<const char*>(node.getStrategySum().data()),
+                       numActions * sizeof(double));
+        });
+    }
+
+    file.close();
+    if (!file.good()) {
+        std::cerr << "Warning: Error writing spill file " << spillFile_
+                  << "; memory budget not enforced\n";
+        return;
+    }
+
+    stats_.spilledNodes += nodeMap_.eraseIf(
+        [&](InfoSetKey, const Node& node) {
+            return node.getVisitCount() <= threshold;
+        });
+
+    if (nodeMap_.memoryBytes() > budgetBytes) {
+        std::cerr << "Warning: Node map still exceeds the memory budget "
+                  << "after spilling; consider a larger --memory-budget\n";
+    }
+}
+
+bool Trainer::mergeSpillFile(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::array<double, Node::MAX_ACTIONS> regretSum;
+    std::array<double, Node::MAX_ACTIONS> strategySum;
+    while (true) {
+        strategy_file::Header header{};
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        if (file.eof() && file.gcount() == 0) {
+            break;  // clean end of the last segment
+        }
+        if (!file.good() ||
+            std::memcmp(header.magic, strategy_file::REGRET_MAGIC,
+                        sizeof(header.magic)) != 0 ||
+            header.version != strategy_file::REGRET_VERSION ||
+            header.numActions < 1 ||
+            header.numActions > static_cast<std::uint32_t>(Node::MAX_ACTIONS)) {
+            std::cerr << "Error: Corrupt spill segment in: " << filename << "\n";
+            return false;
+        }
+
+        for (std::uint64_t n = 0; n < header.entryCount; ++n) {
+            strategy_file::EntryHeader entryHeader{};
+            file.read(reinterpret_cast<char*>(&entryHeader), sizeof(entryHeader));
+            file.read(reinterpret_cast<char*>(regretSum.data()),
+                      header.numActions * sizeof(double));
+            file.read(reinterpret_cast<char*>(strategySum.data()),
+                      header.numActions * sizeof(double));
+            if (!file.good()) {
+                std::cerr << "Error: Truncated spill file: " << filename << "\n";
+                return false;
+            }
+
+            Node& node = nodeMap_.getOrCreate(entryHeader.key,
+                                              static_cast<int>(header.numActions));
+            node.accumulate(regretSum.data(), strategySum.data(),
+                            entryHeader.visitCount);
+        }
+    }
+
+    stats_.informationSetsCount = nodeMap_.size();
+    return true;
+}
+
+void Trainer::reset() {
+    nodeMap_.clear();
+    nodeMap_.setNodeInitializer({});
+    stats_ = TrainingStats{};
+    cumulativeUtilities_.clear();
+    resumeSamplingRng_.clear();
+    resumeIteration_ = 0;
+    resumePending_ = false;
+    spillFile_.clear();
+    warmStartPrior_.clear();
+    warmStartWeight_ = 0.0;
+}
+
+void Trainer::writeProfileReport(const TrainingConfig& config) {
+    stats_.profile = aof::profiling::collect();
+    if (stats_.profile.empty()) {
+        return;
+    }
+
+    // Machine-readable dump next to the strategy output; timer entries
+    // (name suffix "_ns") report scope count and accumulated time
+    std::string filename = config.outputPrefix + "_profile.json";
+    std::ofstream file(filename);
+    if (file.is_open()) {
+        file << "{\n";
+        file << "  \"iterations\": " << stats_.totalIterations << ",\n";
+        file << "  \"total_time_ms\": " << stats_.totalTime.count() << ",\n";
+        file << "  \"counters\": {";
+        bool first = true;
+        for (const auto& entry : stats_.profile) {
+            if (!first) {
+                file << ",";
+            }
+            first = false;
+            file << "\n    \"" << entry.name << "\": ";
+            bool isTimer = entry.name.size() > 3 &&
+                entry.name.compare(entry.name.size() - 3, 3, "_ns") == 0;
+            if (isTimer) {
+                file << "{ \"calls\": " << entry.count
+                     << ", \"total_ns\": " << entry.totalNs << " }";
+            } else {
+                file << entry.count;
+            }
+        }
+        file << "\n  }\n}\n";
+    }
+
+    if (config.enableProgressOutput) {
+        std::cout << "\nHot-path profile (written to " << filename << "):\n";
+        for (const auto& entry : stats_.profile) {
+            std::cout << "  " << std::left << std::setw(24) << entry.name
+                      << std::right << std::setw(16) << entry.count;
+            if (entry.totalNs > 0) {
+                std::cout << "  " << (entry.totalNs / 1000000) << " ms";
+            }
+            std::cout << "\n";
+        }
+        std::cout << std::left;
+    }
+}
+
+ExploitabilityResult Trainer::computeExploitability(int numDeals,
+                                                    int numThreads,
+                                                    std::uint64_t seed) const {
+    BestResponseEvaluator evaluator(game_);
+    evaluator.loadFromNodeMap(nodeMap_);
+    return evaluator.evaluate(numDeals, numThreads, seed);
+}
+
+// Private methods
+double Trainer::mccfr(aof::GameState& state,
+                     int player,
+                     ReachProbs& reachProb,
+                     const UpdatePolicy& policy) {
+
+    if (state.isTerminal()) {
+        auto utilities = state.getReturns();
+        return utilities[player];
+    }
+
+    if (state.isChanceNode()) {
+        aof::GameState::UndoToken undo;
+        state.applyAction(aof::Action::DEAL, undo);
+        double utility = mccfr(state, player, reachProb, policy);
+        state.undoAction(undo);
+        return utility;
+    }
+
+    int currentPlayer = state.getCurrentPlayer();
+    InfoSetKey infoSet = utils::encodeInfoSet(state, currentPlayer);
+
+    auto legalActions = state.getLegalActions();
+    if (legalActions.empty()) {
+        throw std::runtime_error("No legal actions available");
+    }
+
+    // Note: node references are not stable across getOrCreate calls (the
+    // flat map rehashes in place), so never hold one across recursion
+    std::array<double, Node::MAX_ACTIONS> strategy;
+    std::array<bool, Node::MAX_ACTIONS> explored;
+    explored.fill(true);
+    {
+        Node& node = nodeMap_.getOrCreate(infoSet,
+                                          static_cast<int>(legalActions.size()));
+        node.getStrategy(reachProb[currentPlayer], strategy.data(), policy);
+
+        // Regret-based pruning: an action with deeply negative cumulative
+        // regret already gets probability zero from regret matching, so
+        // skipping its subtree changes neither the node utility nor the
+        // siblings' regrets. The strategy[i] == 0 guard keeps at least
+        // one action explored (the strategy always sums to one)
+        if (policy.pruneEnabled && currentPlayer == player) {
+            const auto& regrets = node.getRegretSum();
+            for (std::size_t i = 0; i < legalActions.size(); ++i) {
+                if (regrets[i] <= policy.pruneThreshold && strategy[i] == 0.0) {
+                    explored[i] = false;
+                }
+            }
+        }
+    }
+
+    if (currentPlayer == player) {
+        // Player being trained
+        std::array<double, Node::MAX_ACTIONS> utilities{};
+        double nodeUtility = 0.0;
+
+        // Compute utilities for each action: apply, recurse, undo
+        for (std::size_t i = 0; i < legalActions.size(); ++i) {
+            if (!explored[i]) {
+                AOF_PROF_COUNT(BRANCH_PRUNED);
+                continue;
+            }
+            aof::GameState::UndoToken undo;
+            state.applyAction(legalActions[i], undo);
+
+            double savedReach = reachProb[player];
+            reachProb[player] *= strategy[i];
+
+            utilities[i] = mccfr(state, player, reachProb, policy);
+
+            reachProb[player] = savedReach;
+            state.undoAction(undo);
+
+            nodeUtility += strategy[i] * utilities[i];
+        }
+
+        // Update regrets (re-resolve the node: recursion may have
+        // rehashed); pruned actions keep their regret untouched so the
+        // next re-exploration sees the value they were skipped at
+        Node* node = nodeMap_.find(infoSet);
+        for (std::size_t i = 0; i < legalActions.size(); ++i) {
+            if (!explored[i]) {
+                continue;
+            }
+            double regret = utilities[i] - nodeUtility;
+            node->updateRegret(i, regret, policy);
+        }
+
+        return nodeUtility;
+
+    } else {
+        // Opponent player - sample according to current strategy
+        int actionIndex = utils::sampleAction(strategy.data(),
+                                              static_cast<int>(legalActions.size()));
+
+        aof::GameState::UndoToken undo;
+        state.applyAction(legalActions[actionIndex], undo);
+
+        double savedReach = reachProb[currentPlayer];
+        reachProb[currentPlayer] *= strategy[actionIndex];
+
+        double utility = mccfr(state, player, reachProb, policy);
+
+        reachProb[currentPlayer] = savedReach;
+        state.undoAction(undo);
+
+        return utility;
+    }
+}
+
+double Trainer::mccfrOutcome(aof::GameState& state,
+                            int player,
+                            double reachPlayer,
+                            double reachOthers,
+                            double sampleProb,
+                            double explorationEpsilon,
+                            const UpdatePolicy& policy,
+                            double& tailProb) {
+
+    if (state.isTerminal()) {
+        tailProb = 1.0;
+        // Importance correction: one sampled trajectory stands in for all
+        return state.getReturns()[player] / sampleProb;
+    }
+
+    if (state.isChanceNode()) {
+        aof::GameState::UndoToken undo;
+        state.applyAction(aof::Action::DEAL, undo);
+        double utility = mccfrOutcome(state, player, reachPlayer, reachOthers,
+                                      sampleProb, explorationEpsilon, policy,
+                                      tailProb);
+        state.undoAction(undo);
+        return utility;
+    }
+
+    int currentPlayer = state.getCurrentPlayer();
+    InfoSetKey infoSet = utils::encodeInfoSet(state, currentPlayer);
+
+    auto legalActions = state.getLegalActions();
+    if (legalActions.empty()) {
+        throw std::runtime_error("No legal actions available");
+    }
+    std::size_t numActions = legalActions.size();
+
+    if (currentPlayer == player) {
+        // Average strategy contribution is importance-corrected the same
+        // way as the utility so it stays unbiased under sampling
+        std::array<double, Node::MAX_ACTIONS> strategy;
+        nodeMap_.getOrCreate(infoSet, static_cast<int>(numActions))
+            .getStrategy(reachPlayer / sampleProb, strategy.data(), policy);
+
+        // Epsilon-greedy mix keeps every action's sampling probability positive
+        std::array<double, Node::MAX_ACTIONS> sampleProbs;
+        for (std::size_t i = 0; i < numActions; ++i) {
+            sampleProbs[i] = explorationEpsilon / numActions +
+                             (1.0 - explorationEpsilon) * strategy[i];
+        }
+        int actionIndex = utils::sampleAction(sampleProbs.data(),
+                                              static_cast<int>(numActions));
+
+        aof::GameState::UndoToken undo;
+        state.applyAction(legalActions[actionIndex], undo);
+
+        double childTail = 0.0;
+        double utility = mccfrOutcome(state, player,
+                                      reachPlayer * strategy[actionIndex],
+                                      reachOthers,
+                                      sampleProb * sampleProbs[actionIndex],
+                                      explorationEpsilon, policy, childTail);
+
+        state.undoAction(undo);
+
+        // Counterfactual regret with the unsampled actions' utilities
+        // estimated as zero; the sampled action carries the correction
+        double weight = utility * reachOthers;
+        Node* node = nodeMap_.find(infoSet);
+        for (std::size_t i = 0; i < numActions; ++i) {
+            double regret = (static_cast<int>(i) == actionIndex)
+                ? weight * childTail * (1.0 - strategy[i])
+                : -weight * childTail * strategy[actionIndex];
+            node->updateRegret(i, regret, policy);
+        }
+
+        tailProb = childTail * strategy[actionIndex];
+        return utility;
+
+    } else {
+        // Opponent nodes are sampled on-policy; their average strategy is
+        // accumulated in their own training pass, not here
+        std::array<double, Node::MAX_ACTIONS> strategy;
+        nodeMap_.getOrCreate(infoSet, static_cast<int>(numActions))
+            .getStrategy(0.0, strategy.data(), policy);
+        int actionIndex = utils::sampleAction(strategy.data(),
+                                              static_cast<int>(numActions));
+
+        aof::GameState::UndoToken undo;
+        state.applyAction(legalActions[actionIndex], undo);
+
+        double childTail = 0.0;
+        double utility = mccfrOutcome(state, player, reachPlayer,
+                                      reachOthers * strategy[actionIndex],
+                                      sampleProb * strategy[actionIndex],
+                                      explorationEpsilon, policy, childTail);
+
+        state.undoAction(undo);
+
+        tailProb = childTail * strategy[actionIndex];
+        return utility;
+    }
+}
+
+aof::PlayerUtilities Trainer::trainParallel(const TrainingConfig& config) {
+    if (config.enableProgressOutput) {
+        std::cout << "Starting parallel MCCFR training with " << config.iterations
+                  << " iterations on " << config.numThreads << " threads...\n";
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    ShardedNodeMap sharedNodes;
+
+    // Per-worker deal PRNGs derived from one master seed; note that with
+    // an explicit rngSeed the deals each worker sees are reproducible but
+    // the interleaving of shared-map updates is not
+    if (!resumePending_) {
+        masterSeed_ = (config.rngSeed != 0)
+            ? config.rngSeed : std::random_device{}();
+        cumulativeUtilities_.assign(aof::GameConfig::NUM_PLAYERS, 0.0);
+    }
+
+    int startIteration = 1;
+    if (resumePending_) {
+        // Seed the shared storage with the restored sums; regret matching
+        // only reads the totals, so continued training is exact even
+        // though the parallel update interleaving is not reproducible
+        startIteration = resumeIteration_ + 1;
+        nodeMap_.forEach([&](InfoSetKey key, const Node& node) {
+            auto locked = sharedNodes.getOrCreate(key, node.numActions());
+            locked.node.accumulate(node.getRegretSum().data(),
+                                   node.getStrategySum().data(),
+                                   node.getVisitCount());
+        });
+        resumePending_ = false;
+        if (config.enableProgressOutput) {
+            std::cout << "Resuming from iteration " << resumeIteration_ << "\n";
+        }
+    }
+
+    // Installed after the resume merge so restored nodes are not seeded
+    // on top of their trained sums
+    sharedNodes.setNodeInitializer(makeWarmStartInitializer());
+
+    stats_.totalIterations = startIteration - 1;
+
+    std::atomic<int> nextIteration{startIteration};
+    std::atomic<int> completedIterations{startIteration - 1};
+    std::atomic<bool> stopRequested{false};
+
+    // Per-thread utility accumulators, merged after the workers join
+    std::vector<aof::PlayerUtilities> threadUtilities(
+        config.numThreads, aof::PlayerUtilities(aof::GameConfig::NUM_PLAYERS, 0.0));
+
+    std::vector<std::thread> workers;
+    workers.reserve(config.numThreads);
+
+    // Shifted by the resumed iteration count so a continued run deals
+    // fresh hands rather than replaying the ones already trained on
+    std::uint64_t dealSeedBase = masterSeed_ +
+        static_cast<std::uint64_t>(startIteration - 1);
+
+    for (int t = 0; t < config.numThreads; ++t) {
+        workers.emplace_back([&, t]() {
+            aof::FastRng dealRng(dealSeedBase + static_cast<std::uint64_t>(t));
+            if (config.rngSeed != 0) {
+                utils::seedThreadRng(dealSeedBase + static_cast<std::uint64_t>(t));
+            }
+
+            // Each claim covers a whole batch so batched runs keep their
+            // staged processing per worker; batchSize == 1 claims one
+            // iteration at a time exactly as before
+            const int batchSize = std::max(1, config.batchSize);
+            std::vector<std::unique_ptr<aof::GameState>> batchStates;
+            batchStates.reserve(batchSize);
+
+            while (true) {
+                int batchStart = nextIteration.fetch_add(batchSize,
+                                                         std::memory_order_relaxed);
+                if (batchStart > config.iterations ||
+                    stopRequested.load(std::memory_order_relaxed)) {
+                    break;
+                }
+                int batchCount = std::min(batchSize,
+                                          config.iterations - batchStart + 1);
+
+                // Stage 1: deal the whole batch up front
+                batchStates.clear();
+                for (int k = 0; k < batchCount; ++k) {
+                    batchStates.push_back(game_.createInitialState(dealRng.next()));
+                }
+
+                // Stage 2: traverse each deal in iteration order
+                for (int k = 0; k < batchCount; ++k) {
+                    UpdatePolicy policy = makeUpdatePolicy(config, batchStart + k);
+
+                    ReachProbs reachProb;
+                    for (int player = 0; player < aof::GameConfig::NUM_PLAYERS; ++player) {
+                        if (config.samplingScheme == SamplingScheme::OUTCOME) {
+                            double tailProb = 0.0;
+                            mccfrOutcomeSharded(sharedNodes, *batchStates[k], player,
+                                                1.0, 1.0, 1.0,
+                                                config.explorationEpsilon, policy,
+                                                tailProb);
+                        } else {
+                            reachProb.fill(1.0);
+                            mccfrSharded(sharedNodes, *batchStates[k], player,
+                                         reachProb, policy);
+                        }
+                    }
+                }
+
+                // Stage 3: track exact utilities from one terminal outcome per
+                // iteration, same as the single-threaded path but sampled per
+                // worker; the batch's showdown walks run back to back
+                for (int k = 0; k < batchCount; ++k) {
+                    auto terminalState = std::make_unique<aof::GameState>(*batchStates[k]);
+                    while (!terminalState->isTerminal()) {
+                        if (terminalState->isChanceNode()) {
+                            terminalState->applyAction(aof::Action::DEAL);
+                            continue;
+                        }
+
+                        auto legalActions = terminalState->getLegalActions();
+                        if (legalActions.empty()) {
+                            break;
+                        }
+
+                        InfoSetKey infoSet = utils::encodeInfoSet(
+                            *terminalState, terminalState->getCurrentPlayer());
+                        std::vector<double> strategy;
+                        {
+                            auto locked = sharedNodes.getOrCreate(
+                                infoSet, static_cast<int>(legalActions.size()));
+                            strategy = locked.node.getAverageStrategy();
+                        }
+
+                        int bestAction = 0;
+                        for (std::size_t i = 1; i < strategy.size(); ++i) {
+                            if (strategy[i] > strategy[bestAction]) {
+                                bestAction = static_cast<int>(i);
+                            }
+                        }
+                        terminalState->applyAction(legalActions[bestAction]);
+                    }
+
+                    if (terminalState->isTerminal()) {
+                        auto exactUtilities = terminalState->getReturns();
+                        for (int player = 0; player < aof::GameConfig::NUM_PLAYERS; ++player) {
+                            threadUtilities[t][player] += exactUtilities[player];
+                        }
+                    }
+                }
+
+                int completed = completedIterations.fetch_add(
+                    batchCount, std::memory_order_relaxed) + batchCount;
+
+                // Only the first worker reports progress to keep output readable
+                if (t == 0 && config.enableProgressOutput &&
+                    (completed / config.progressUpdateInterval >
+                     (completed - batchCount) / config.progressUpdateInterval)) {
+                    updateProgress(completed, config.iterations, startTime, config);
+                }
+            }
+        });
+    }
+
+    // Checkpoints are cut from this thread while the workers run: copy the
+    // sharded storage under its per-shard locks, then serialize the copy on
+    // a background writer so the polling loop never blocks on disk I/O.
+    std::thread checkpointWriter;
+    std::deque<std::string> checkpointFiles;
+    int lastCheckpoint = startIteration - 1;
+    int lastEvaluation = startIteration - 1;
+    while ((config.checkpointInterval > 0 || config.exploitabilityInterval > 0) &&
+           completedIterations.load(std::memory_order_relaxed) < config.iterations &&
+           !stopRequested.load(std::memory_order_relaxed)) {
+        int completed = completedIterations.load(std::memory_order_relaxed);
+        if (config.checkpointInterval > 0 &&
+            completed - lastCheckpoint >= config.checkpointInterval &&
+            completed < config.iterations) {
+            lastCheckpoint = completed;
+            if (checkpointWriter.joinable()) {
+                checkpointWriter.join();
+            }
+            auto snapshot = std::make_shared<FlatNodeMap>();
+            sharedNodes.copyInto(*snapshot);
+            std::string checkpointFile = config.outputPrefix + "_checkpoint_" +
+                                         std::to_string(completed) + ".txt";
+            checkpointFiles.push_back(checkpointFile);
+            std::string staleFile;
+            if (config.checkpointsToKeep > 0 &&
+                checkpointFiles.size() > static_cast<std::size_t>(config.checkpointsToKeep)) {
+                staleFile = checkpointFiles.front();
+                checkpointFiles.pop_front();
+            }
+            // The resume checkpoint's utility sums are read without
+            // synchronization while the workers run; they are a
+            // display-only statistic, with the same relaxed semantics as
+            // the rest of the parallel path. The sampling RNG state lives
+            // in the workers' thread-locals and is not captured, so a
+            // parallel resume reseeds instead of continuing the streams.
+            auto resumeUtilities = cumulativeUtilities_;
+            for (int player = 0; player < aof::GameConfig::NUM_PLAYERS; ++player) {
+                for (int t = 0; t < config.numThreads; ++t) {
+                    resumeUtilities[player] += threadUtilities[t][player];
+                }
+            }
+            std::string resumeFile = config.outputPrefix + "_resume.ckpt";
+            std::uint64_t resumeSeed = masterSeed_;
+
+            checkpointWriter = std::thread(
+                [this, snapshot, checkpointFile, staleFile, completed,
+                 resumeFile, resumeSeed, resumeUtilities]() {
+                    writeStrategies(*snapshot, checkpointFile, true, completed);
+                    writeCheckpoint(*snapshot, resumeFile, completed, resumeSeed,
+                                    resumeUtilities, std::string());
+                    if (!staleFile.empty()) {
+                        std::remove(staleFile.c_str());
+                    }
+                });
+        }
+        // Exploitability is evaluated from this thread against a snapshot;
+        // the workers keep training while the tree is solved
+        if (config.exploitabilityInterval > 0 &&
+            completed - lastEvaluation >= config.exploitabilityInterval &&
+            completed < config.iterations) {
+            lastEvaluation = completed;
+            FlatNodeMap snapshot;
+            sharedNodes.copyInto(snapshot);
+            BestResponseEvaluator evaluator(game_);
+            evaluator.loadFromNodeMap(snapshot);
+            auto result = evaluator.evaluate(config.exploitabilityDeals,
+                                             config.numThreads);
+            if (config.enableProgressOutput) {
+                std::cout << "\nExploitability at iteration " << completed
+                          << ": " << std::fixed << std::setprecision(6)
+                          << result.exploitability << " chips/hand\n";
+            }
+            if (config.exploitabilityThreshold > 0.0 &&
+                result.exploitability <= config.exploitabilityThreshold) {
+                if (config.enableProgressOutput) {
+                    std::cout << "Exploitability below threshold "
+                              << config.exploitabilityThreshold
+                              << ", stopping early\n";
+                }
+                stopRequested.store(true, std::memory_order_relaxed);
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    if (checkpointWriter.joinable()) {
+        checkpointWriter.join();
+    }
+
+    // Merge sharded storage into the trainer's node map so the existing
+    // save/query paths work unchanged
+    sharedNodes.mergeInto(nodeMap_);
+
+    // An early stop leaves fewer iterations completed than requested
+    int iterationsRun = completedIterations.load(std::memory_order_relaxed);
+
+    // Fold this session's utility sums into the running totals (which a
+    // resumed run restored from the checkpoint) before averaging
+    for (int player = 0; player < aof::GameConfig::NUM_PLAYERS; ++player) {
+        for (int t = 0; t < config.numThreads; ++t) {
+            cumulativeUtilities_[player] += threadUtilities[t][player];
+        }
+    }
+
+    aof::PlayerUtilities avgUtilities(aof::GameConfig::NUM_PLAYERS, 0.0);
+    for (int player = 0; player < aof::GameConfig::NUM_PLAYERS; ++player) {
+        avgUtilities[player] = cumulativeUtilities_[player] /
+                               std::max(1, iterationsRun);
+    }
+
+    auto endTime = std::chrono::steady_clock::now();
+    stats_.totalIterations = iterationsRun;
+    stats_.totalTime = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
+    stats_.informationSetsCount = nodeMap_.size();
+    stats_.finalUtilities = avgUtilities;
+    writeProfileReport(config);
+
+    if (config.enableProgressOutput) {
+        std::cout << "\n\nTraining completed!\n";
+        std::cout << "Total time: " << formatDuration(stats_.totalTime) << "\n";
+        std::cout << "Information sets learned: " << nodeMap_.size() << "\n";
+
+        double itersPerSecond = (stats_.totalTime.count() > 0)
+            ? (iterationsRun - startIteration + 1) * 1000.0 / stats_.totalTime.count()
+            : 0.0;
+        std::cout << "Throughput: " << std::fixed << std::setprecision(1)
+                  << itersPerSecond << " iterations/second\n";
+
+        std::cout << "Final average utilities: [";
+        for (std::size_t i = 0; i < avgUtilities.size(); ++i) {
+            if (i > 0) std::cout << ", ";
+            std::cout << std::fixed << std::setprecision(16) << avgUtilities[i];
+        }
+        std::cout << "]\n";
+    }
+
+    // Save strategies with timestamp, matching the single-threaded path
+    auto now = std::chrono::system_clock::now();
+    auto time_t = std::chrono::system_clock::to_time_t(now);
+    auto tm = *std::localtime(&time_t);
+
+    std::stringstream filename;
+    filename << config.outputPrefix << "_"
+             << (tm.tm_year + 1900) << "_"
+             << std::setfill('0') << std::setw(2) << (tm.tm_mon + 1) << "_"
+             << std::setw(2) << tm.tm_mday << "_"
+             << std::setw(2) << tm.tm_hour << "_"
+             << std::setw(2) << tm.tm_min << "_"
+             << std::setw(2) << tm.tm_sec << ".txt";
+
+    saveStrategies(filename.str());
+
+    return avgUtilities;
+}
+
+double Trainer::mccfrSharded(ShardedNodeMap& nodes,
+                            aof::GameState& state,
+                            int player,
+                            ReachProbs& reachProb,
+                            const UpdatePolicy& policy) {
+
+    if (state.isTerminal()) {
+        auto utilities = state.getReturns();
+        return utilities[player];
+    }
+
+    if (state.isChanceNode()) {
+        aof::GameState::UndoToken undo;
+        state.applyAction(aof::Action::DEAL, undo);
+        double utility = mccfrSharded(nodes, state, player, reachProb, policy);
+        state.undoAction(undo);
+        return utility;
+    }
+
+    int currentPlayer = state.getCurrentPlayer();
+    InfoSetKey infoSet = utils::encodeInfoSet(state, currentPlayer);
+
+    auto legalActions = state.getLegalActions();
+    if (legalActions.empty()) {
+        throw std::runtime_error("No legal actions available");
+    }
+
+    if (currentPlayer == player) {
+        // Player being trained. The shard lock is released before recursing
+        // so a recursive visit to another node in the same shard cannot deadlock.
+        std::array<double, Node::MAX_ACTIONS> strategy;
+        std::array<bool, Node::MAX_ACTIONS> explored;
+        explored.fill(true);
+        {
+            auto locked = nodes.getOrCreate(infoSet, static_cast<int>(legalActions.size()));
+            locked.node.getStrategy(reachProb[player], strategy.data(), policy);
+
+            // Same regret-based pruning as the single-threaded traversal;
+            // the decision uses the regrets as of this lock and tolerates
+            // other workers moving them concurrently (pruning is a
+            // heuristic skip, not a correctness condition)
+            if (policy.pruneEnabled) {
+                const auto& regrets = locked.node.getRegretSum();
+                for (std::size_t i = 0; i < legalActions.size(); ++i) {
+                    if (regrets[i] <= policy.pruneThreshold && strategy[i] == 0.0) {
+                        explored[i] = false;
+                    }
+                }
+            }
+        }
+
+        std::array<double, Node::MAX_ACTIONS> utilities{};
+        double nodeUtility = 0.0;
+
+        for (std::size_t i = 0; i < legalActions.size(); ++i) {
+            if (!explored[i]) {
+                AOF_PROF_COUNT(BRANCH_PRUNED);
+                continue;
+            }
+            aof::GameState::UndoToken undo;
+            state.applyAction(legalActions[i], undo);
+
+            double savedReach = reachProb[player];
+            reachProb[player] *= strategy[i];
+
+            utilities[i] = mccfrSharded(nodes, state, player, reachProb,
+                                        policy);
+
+            reachProb[player] = savedReach;
+            state.undoAction(undo);
+
+            nodeUtility += strategy[i] * utilities[i];
+        }
+
+        {
+            auto locked = nodes.getOrCreate(infoSet, static_cast<int>(legalActions.size()));
+            for (std::size_t i = 0; i < legalActions.size(); ++i) {
+                if (!explored[i]) {
+                    continue;
+                }
+                locked.node.updateRegret(static_cast<int>(i),
+                                         utilities[i] - nodeUtility, policy);
+            }
+        }
+
+        return nodeUtility;
+
+    } else {
+        // Opponent player - sample according to current strategy
+        std::array<double, Node::MAX_ACTIONS> strategy;
+        {
+            auto locked = nodes.getOrCreate(infoSet, static_cast<int>(legalActions.size()));
+            locked.node.getStrategy(reachProb[currentPlayer], strategy.data(),
+                                    policy);
+        }
+
+        int actionIndex = utils::sampleAction(strategy.data(),
+                                              static_cast<int>(legalActions.size()));
+
+        aof::GameState::UndoToken undo;
+        state.applyAction(legalActions[actionIndex], undo);
+
+        double savedReach = reachProb[currentPlayer];
+        reachProb[currentPlayer] *= strategy[actionIndex];
+
+        double utility = mccfrSharded(nodes, state, player, reachProb, policy);
+
+        reachProb[currentPlayer] = savedReach;
+        state.undoAction(undo);
+
+        return utility;
+    }
+}
+
+double Trainer::mccfrOutcomeSharded(ShardedNodeMap& nodes,
+                                   aof::GameState& state,
+                                   int player,
+                                   double reachPlayer,
+                                   double reachOthers,
+                                   double sampleProb,
+                                   double explorationEpsilon,
+                                   const UpdatePolicy& policy,
+                                   double& tailProb) {
+
+    if (state.isTerminal()) {
+        tailProb = 1.0;
+        return state.getReturns()[player] / sampleProb;
+    }
+
+    if (state.isChanceNode()) {
+        aof::GameState::UndoToken undo;
+        state.applyAction(aof::Action::DEAL, undo);
+        double utility = mccfrOutcomeSharded(nodes, state, player, reachPlayer,
+                                             reachOthers, sampleProb,
+                                             explorationEpsilon, policy,
+                                             tailProb);
+        state.undoAction(undo);
+        return utility;
+    }
+
+    int currentPlayer = state.getCurrentPlayer();
+    InfoSetKey infoSet = utils::encodeInfoSet(state, currentPlayer);
+
+    auto legalActions = state.getLegalActions();
+    if (legalActions.empty()) {
+        throw std::runtime_error("No legal actions available");
+    }
+    std::size_t numActions = legalActions.size();
+
+    if (currentPlayer == player) {
+        std::array<double, Node::MAX_ACTIONS> strategy;
+        {
+            auto locked = nodes.getOrCreate(infoSet, static_cast<int>(numActions));
+            locked.node.getStrategy(reachPlayer / sampleProb, strategy.data(),
+                                    policy);
+        }
+
+        std::array<double, Node::MAX_ACTIONS> sampleProbs;
+        for (std::size_t i = 0; i < numActions; ++i) {
+            sampleProbs[i] = explorationEpsilon / numActions +
+                             (1.0 - explorationEpsilon) * strategy[i];
+        }
+        int actionIndex = utils::sampleAction(sampleProbs.data(),
+                                              static_cast<int>(numActions));
+
+        aof::GameState::UndoToken undo;
+        state.applyAction(legalActions[actionIndex], undo);
+
+        double childTail = 0.0;
+        double utility = mccfrOutcomeSharded(nodes, state, player,
+                                             reachPlayer * strategy[actionIndex],
+                                             reachOthers,
+                                             sampleProb * sampleProbs[actionIndex],
+                                             explorationEpsilon, policy,
+                                             childTail);
+
+        state.undoAction(undo);
+
+        double weight = utility * reachOthers;
+        {
+            auto locked = nodes.getOrCreate(infoSet, static_cast<int>(numActions));
+            for (std::size_t i = 0; i < numActions; ++i) {
+                double regret = (static_cast<int>(i) == actionIndex)
+                    ? weight * childTail * (1.0 - strategy[i])
+                    : -weight * childTail * strategy[actionIndex];
+                locked.node.updateRegret(static_cast<int>(i), regret, policy);
+            }
+        }
+
+        tailProb = childTail * strategy[actionIndex];
+        return utility;
+
+    } else {
+        std::array<double, Node::MAX_ACTIONS> strategy;
+        {
+            auto locked = nodes.getOrCreate(infoSet, static_cast<int>(numActions));
+            locked.node.getStrategy(0.0, strategy.data(), policy);
+        }
+        int actionIndex = utils::sampleAction(strategy.data(),
+                                              static_cast<int>(numActions));
+
+        aof::GameState::UndoToken undo;
+        state.applyAction(legalActions[actionIndex], undo);
+
+        double childTail = 0.0;
+        double utility = mccfrOutcomeSharded(nodes, state, player, reachPlayer,
+                                             reachOthers * strategy[actionIndex],
+                                             sampleProb * strategy[actionIndex],
+                                             explorationEpsilon, policy,
+                                             childTail);
+
+        state.undoAction(undo);
+
+        tailProb = childTail * strategy[actionIndex];
+        return utility;
+    }
+}
+
+void Trainer::updateProgress(int iteration, int totalIterations,
+                           std::chrono::steady_clock::time_point startTime,
+                           const TrainingConfig& /* config */) const {
+    
+    auto currentTime = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(currentTime - startTime);
+    
+    double percentage = (static_cast<double>(iteration) / totalIterations) * 100.0;
+    
+    // Estimate remaining time
+    double avgTimePerIter = elapsed.count() / static_cast<double>(iteration);
+    int remainingIters = totalIterations - iteration;
+    auto estimatedRemaining = std::chrono::milliseconds(
+        static_cast<long long>(avgTimePerIter * remainingIters));
+    
+    std::cout << "\rIteration " << iteration << " (" 
+              << std::fixed << std::setprecision(2) << percentage 
+              << "% completed, ETA: " << formatDuration(estimatedRemaining) << ")" 
+              << std::flush;
+}
+
+std::string Trainer::formatDuration(std::chrono::milliseconds duration) const {
+    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(duration);
+    auto minutes = std::chrono::duration_cast<std::chrono::minutes>(seconds);
+    auto hours = std::chrono::duration_cast<std::chrono::hours>(minutes);
+    
+    std::stringstream ss;
+    
+    if (hours.count() > 0) {
+        ss << hours.count() << "h ";
+        minutes -= hours;
+    }
+    
+    if (minutes.count() > 0) {
+        ss << minutes.count() << "m ";
+        seconds -= minutes;
+    }
+    
+    ss << seconds.count() << "s";
+    
+    return ss.str();
 }
 
 double Trainer::calculateUtilityVariance(const aof::PlayerUtilities& utilities) const {
@@ -490,12 +1963,12 @@ aof::PlayerUtilities Trainer::getExactUtilities(std::unique_ptr<aof::GameState>
             }
             
             // Get current strategy for this information set
-            std::string infoSet = utils::getInformationSet(*state, currentPlayer);
-            auto it = nodeMap_.find(infoSet);
-            
-            if (it != nodeMap_.end()) {
+            InfoSetKey infoSet = utils::encodeInfoSet(*state, currentPlayer);
+            const Node* node = nodeMap_.find(infoSet);
+
+            if (node != nullptr) {
                 // Use learned strategy
-                auto strategy = it->second.getAverageStrategy();
+                auto strategy = node->getAverageStrategy();
                 
                 // For exact utilities, use the action with highest probability
                 // (or sample according to strategy for more realistic outcomes)
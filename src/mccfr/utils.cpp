@@ -18,12 +18,9 @@ std::string getInformationSet(const aof::GameState& state, int player) {
         for (int p = 0; p < 4; ++p) {
             if (p != player) {
                 ss << "[P" << p;
-                const auto& folded = state.getFoldedPlayers();
-                const auto& allIn = state.getAllInPlayers();
-                
-                if (folded[p]) {
+                if (state.hasFolded(p)) {
                     ss << ":F";  // Folded
-                } else if (allIn.count(p) > 0) {
+                } else if (state.isAllIn(p)) {
                     ss << ":A";  // All-in
                 } else {
                     ss << ":P";  // Playing/Pending
@@ -35,12 +32,9 @@ std::string getInformationSet(const aof::GameState& state, int player) {
         // Players 2 and 3 only see previous players' actions
         for (int p = 0; p < player; ++p) {
             ss << "[P" << p;
-            const auto& folded = state.getFoldedPlayers();
-            const auto& allIn = state.getAllInPlayers();
-            
-            if (folded[p]) {
+            if (state.hasFolded(p)) {
                 ss << ":F";
-            } else if (allIn.count(p) > 0) {
+            } else if (state.isAllIn(p)) {
                 ss << ":A";
             } else {
                 ss << ":P";
@@ -67,71 +61,79 @@ std::string getInformationSet(const aof::GameState& state, int player) {
 }
 
 int sampleAction(const std::vector<double>& strategy, std::mt19937& rng) {
-    if (strategy.empty()) {
+    return sampleAction(strategy.data(), static_cast<int>(strategy.size()), rng);
+}
+
+int sampleAction(const std::vector<double>& strategy) {
+    return sampleAction(strategy.data(), static_cast<int>(strategy.size()));
+}
+
+int sampleAction(const double* strategy, int numActions, std::mt19937& rng) {
+    if (numActions <= 0) {
         throw std::invalid_argument("Strategy cannot be empty");
     }
-    
+
     std::uniform_real_distribution<double> dist(0.0, 1.0);
     double r = dist(rng);
-    
+
     double cumulative = 0.0;
-    for (std::size_t i = 0; i < strategy.size(); ++i) {
+    for (int i = 0; i < numActions; ++i) {
         cumulative += strategy[i];
         if (r < cumulative) {
-            return static_cast<int>(i);
+            return i;
         }
     }
-    
+
     // Fallback to last action (handles floating point precision issues)
-    return static_cast<int>(strategy.size() - 1);
+    return numActions - 1;
 }
 
-int sampleAction(const std::vector<double>& strategy) {
-    // Thread-local random number generator
+namespace {
+
+/// Per-thread sampling RNG shared by sampleAction and seedThreadRng
+std::mt19937& threadRng() {
     thread_local std::mt19937 rng(std::random_device{}());
-    return sampleAction(strategy, rng);
+    return rng;
 }
 
-std::string abstractHoleCards(const aof::Card& card1, const aof::Card& card2) {
-    // Get rank values for comparison
-    int rank1 = card1.getRankValue();
-    int rank2 = card2.getRankValue();
-    
-    // Order cards by rank (higher first)
-    const aof::Card* highCard = &card1;
-    const aof::Card* lowCard = &card2;
-    
-    if (rank1 < rank2) {
-        std::swap(highCard, lowCard);
-    }
-    
-    std::stringstream ss;
-    ss << highCard->getRank();
-    
-    // For pairs, just show the rank twice
-    if (highCard->getRankValue() == lowCard->getRankValue()) {
-        ss << lowCard->getRank();
-    } else {
-        ss << lowCard->getRank();
-        // Add suited/offsuit indicator
-        ss << (aof::card_utils::areSuited(*highCard, *lowCard) ? "s" : "o");
-    }
-    
+} // namespace
+
+int sampleAction(const double* strategy, int numActions) {
+    return sampleAction(strategy, numActions, threadRng());
+}
+
+void seedThreadRng(std::uint64_t seed) {
+    threadRng().seed(static_cast<std::uint32_t>(seed ^ (seed >> 32)));
+}
+
+std::string saveThreadRngState() {
+    // std::mt19937 streams its full state as whitespace-separated words
+    std::ostringstream ss;
+    ss << threadRng();
     return ss.str();
 }
 
+bool restoreThreadRngState(const std::string& state) {
+    std::istringstream ss(state);
+    ss >> threadRng();
+    return !ss.fail();
+}
+
+std::string abstractHoleCards(const aof::Card& card1, const aof::Card& card2) {
+    // Single array load from the compile-time 169-class table
+    return aof::card_utils::getBucketLabel(
+        aof::card_utils::getBucketId(card1, card2));
+}
+
 std::string getActionHistory(const aof::GameState& state, int upToPlayer) {
     std::stringstream ss;
     
-    const auto& folded = state.getFoldedPlayers();
-    const auto& allIn = state.getAllInPlayers();
-    
     for (int p = 0; p < upToPlayer && p < 4; ++p) {
         if (p > 0) ss << ",";
         
-        if (folded[p]) {
+        if (state.hasFolded(p)) {
             ss << "F";
-        } else if (allIn.count(p) > 0) {
+        } else if (state.isAllIn(p)) {
             ss << "A";
         } else {
             ss << "P";
@@ -86,7 +86,38 @@ void testDeck() {
     // Reset deck
     deck.reset();
     assert(deck.size() == 52);
-    
+
+    // Same seed deals the same sequence, different seeds diverge
+    aof::Deck deckA(999);
+    aof::Deck deckB(999);
+    aof::Deck deckC(1000);
+    auto sequenceA = deckA.dealCards(13);
+    auto sequenceB = deckB.dealCards(13);
+    auto sequenceC = deckC.dealCards(13);
+    assert(sequenceA == sequenceB);
+    assert(sequenceA != sequenceC);
+
+    // A full deal produces all 52 distinct cards
+    deckA.reset();
+    bool seen[52] = {};
+    for (int i = 0; i < 52; ++i) {
+        auto card = deckA.dealCard();
+        assert(card.isValid());
+        assert(!seen[card.getCode()]);
+        seen[card.getCode()] = true;
+    }
+    assert(deckA.isEmpty());
+
+    // Returned cards replay identically (required by undoAction)
+    aof::Deck replayDeck(4321);
+    auto first = replayDeck.dealCard();
+    auto second = replayDeck.dealCard();
+    replayDeck.returnCard(second);
+    replayDeck.returnCard(first);
+    assert(replayDeck.size() == 52);
+    assert(replayDeck.dealCard() == first);
+    assert(replayDeck.dealCard() == second);
+
     std::cout << "Deck tests passed!" << std::endl;
 }
 
@@ -112,7 +143,32 @@ void testCardUtils() {
     // Test pair abstraction
     std::string pairAbstracted = aof::card_utils::getAbstractedHoleCards(aceSpades, aceHearts);
     assert(pairAbstracted.find("AA") != std::string::npos);
-    
+
+    // Bucket ids come from the compile-time 169-class table and are
+    // order-independent
+    static_assert(aof::card_utils::NUM_HOLE_BUCKETS == 169,
+                  "13x13 preflop grid");
+    assert(aof::card_utils::getBucketId(aceSpades, kingSpades) ==
+           aof::card_utils::getBucketId(kingSpades, aceSpades));
+    assert(aof::card_utils::getBucketId(aceSpades, kingSpades) !=
+           aof::card_utils::getBucketId(aceSpades, aof::Card("K", "h")));
+
+    // Labels match the string abstraction for every bucket-representative
+    // pair: suited, offsuit and pairs, including the two-character "10"
+    assert(std::string(aof::card_utils::getBucketLabel(
+               aof::card_utils::getBucketId(aceSpades, kingSpades))) == "AKs");
+    assert(std::string(aof::card_utils::getBucketLabel(
+               aof::card_utils::getBucketId(aceSpades, aof::Card("K", "h")))) == "AKo");
+    assert(std::string(aof::card_utils::getBucketLabel(
+               aof::card_utils::getBucketId(aceSpades, aceHearts))) == "AA");
+    assert(std::string(aof::card_utils::getBucketLabel(
+               aof::card_utils::getBucketId(aof::Card("10", "s"),
+                                            aof::Card("10", "h")))) == "1010");
+
+    for (int id = 0; id < aof::card_utils::NUM_HOLE_BUCKETS; ++id) {
+        assert(aof::card_utils::getBucketLabel(id)[0] != '\0');
+    }
+
     std::cout << "Card utilities tests passed!" << std::endl;
 }
 
@@ -1,7 +1,10 @@
 #include <iostream>
 #include <cassert>
+#include "aof/equity_engine.hpp"
 #include "aof/game.hpp"
 #include "aof/game_state.hpp"
+#include <array>
+#include <cstdio>
 
 void testInitialState() {
     std::cout << "Testing initial game state..." << std::endl;
@@ -26,11 +29,7 @@ void testInitialState() {
     assert(stacks[3] == 8.0);  // No blind
     
     // Check folded status
-    auto folded = state->getFoldedPlayers();
-    for (bool f : folded) {
-        assert(!f);  // No one should be folded initially
-        (void)f; // Suppress unused variable warning
-    }
+    assert(state->getFoldedMask() == 0);  // No one should be folded initially
     
     // Legal actions should be DEAL only
     auto actions = state->getLegalActions();
@@ -89,9 +88,8 @@ void testPlayerActions() {
     state->applyAction(aof::Action::FOLD);
     
     // Check folded status
-    auto folded = state->getFoldedPlayers();
-    assert(folded[2]);
-    assert(!folded[0] && !folded[1] && !folded[3]);
+    assert(state->hasFolded(2));
+    assert(!state->hasFolded(0) && !state->hasFolded(1) && !state->hasFolded(3));
     
     // Player 3 goes all-in
     assert(state->getCurrentPlayer() == 3);
@@ -101,8 +99,7 @@ void testPlayerActions() {
     state->applyAction(aof::Action::ALL_IN);
     
     // Check all-in status
-    auto allInPlayers = state->getAllInPlayers();
-    assert(allInPlayers.count(3) > 0);
+    assert(state->isAllIn(3));
     
     // Check pot increased
     assert(state->getPot() == initialPot + player3Stack);
@@ -165,8 +162,7 @@ void testAllInScenario() {
     assert(state->isTerminal());
     
     // All players should be all-in
-    auto allInPlayers = state->getAllInPlayers();
-    assert(allInPlayers.size() == 4);
+    assert(state->getAllInMask() == 0b1111);
     
     // Should have community cards
     auto communityCards = state->getCommunityCards();
@@ -201,7 +197,7 @@ void testStateCloning() {
     // Both states should be identical
     assert(state1->getCurrentPlayer() == state2->getCurrentPlayer());
     assert(state1->getPot() == state2->getPot());
-    assert(state1->getFoldedPlayers() == state2->getFoldedPlayers());
+    assert(state1->getFoldedMask() == state2->getFoldedMask());
     assert(state1->getHoleCards() == state2->getHoleCards());
     
     // Modify one state
@@ -214,6 +210,190 @@ void testStateCloning() {
     std::cout << "State cloning tests passed!" << std::endl;
 }
 
+void testEquityEngine() {
+    std::cout << "Testing equity engine..." << std::endl;
+
+    // Small sample count keeps the test fast; estimates stay well inside
+    // the loose bounds below
+    aof::EquityEngine engine(5000);
+
+    // AA is a heavy favorite against 72o
+    std::array<aof::Card, 4> holeCards = {
+        aof::Card("A", "s"), aof::Card("A", "h"),
+        aof::Card("7", "c"), aof::Card("2", "d")
+    };
+    std::array<double, 2> equities{};
+    engine.getEquities(holeCards.data(), 2, equities.data());
+    assert(std::abs(equities[0] + equities[1] - 1.0) < 1e-9);
+    assert(equities[0] > 0.7);
+
+    // Identical buckets are averaged to identical equity
+    std::array<aof::Card, 4> mirrored = {
+        aof::Card("A", "s"), aof::Card("K", "s"),
+        aof::Card("A", "h"), aof::Card("K", "h")
+    };
+    std::array<double, 2> mirroredEquities{};
+    engine.getEquities(mirrored.data(), 2, mirroredEquities.data());
+    assert(std::abs(mirroredEquities[0] - 0.5) < 1e-9);
+    assert(std::abs(mirroredEquities[1] - 0.5) < 1e-9);
+
+    // Entries are cached and deterministic
+    std::size_t cachedEntries = engine.tableSize();
+    std::array<double, 2> again{};
+    engine.getEquities(holeCards.data(), 2, again.data());
+    assert(engine.tableSize() == cachedEntries);
+    assert(again[0] == equities[0] && again[1] == equities[1]);
+
+    // Tables round-trip through save/load
+    const std::string tableFile = "test_equity_table.txt";
+    assert(engine.saveTable(tableFile));
+    aof::EquityEngine reloaded(5000);
+    assert(reloaded.loadTable(tableFile));
+    assert(reloaded.tableSize() == engine.tableSize());
+    std::array<double, 2> fromFile{};
+    reloaded.getEquities(holeCards.data(), 2, fromFile.data());
+    assert(std::abs(fromFile[0] - equities[0]) < 1e-9);
+    std::remove(tableFile.c_str());
+
+    // Expected-value terminal mode: returns are deterministic per deal
+    // and still zero-sum
+    aof::Game game(0.4, 1.0);
+    game.setEquityEngine(std::make_shared<aof::EquityEngine>(2000));
+
+    auto state = game.createInitialState();
+    state->applyAction(aof::Action::DEAL);
+    state->applyAction(aof::Action::ALL_IN);
+    state->applyAction(aof::Action::ALL_IN);
+    state->applyAction(aof::Action::ALL_IN);
+    state->applyAction(aof::Action::ALL_IN);
+    assert(state->isTerminal());
+
+    auto expectedReturns = state->getReturns();
+    auto repeatedReturns = state->getReturns();
+    double total = 0;
+    for (std::size_t i = 0; i < expectedReturns.size(); ++i) {
+        assert(expectedReturns[i] == repeatedReturns[i]);
+        total += expectedReturns[i];
+    }
+    assert(std::abs(total) < 0.01);
+
+    std::cout << "Equity engine tests passed!" << std::endl;
+}
+
+void testBoardEquityEstimator() {
+    std::cout << "Testing board equity estimator..." << std::endl;
+
+    aof::EquityEngine engine;
+
+    // Concrete AsAh vs 7c2d is roughly an 88/12 favorite
+    std::array<aof::Card, 4> holeCards = {
+        aof::Card("A", "s"), aof::Card("A", "h"),
+        aof::Card("7", "c"), aof::Card("2", "d")
+    };
+    std::array<double, 2> equities{};
+    engine.estimateEquities(holeCards.data(), 2, 40000, 99, equities.data());
+    assert(std::abs(equities[0] + equities[1] - 1.0) < 1e-9);
+    assert(equities[0] > 0.85 && equities[0] < 0.92);
+
+    // Deterministic for a given seed; a fresh seed stays within noise
+    std::array<double, 2> repeated{};
+    engine.estimateEquities(holeCards.data(), 2, 40000, 99, repeated.data());
+    assert(repeated[0] == equities[0] && repeated[1] == equities[1]);
+
+    std::array<double, 2> reseeded{};
+    engine.estimateEquities(holeCards.data(), 2, 40000, 100, reseeded.data());
+    assert(std::abs(reseeded[0] - equities[0]) < 0.02);
+
+    // Three-way lineups still sum to 1 and keep the favorite on top
+    std::array<aof::Card, 6> threeWay = {
+        aof::Card("A", "s"), aof::Card("A", "h"),
+        aof::Card("K", "d"), aof::Card("K", "c"),
+        aof::Card("7", "c"), aof::Card("2", "d")
+    };
+    std::array<double, 3> threeWayEquities{};
+    engine.estimateEquities(threeWay.data(), 3, 20000, 7,
+                            threeWayEquities.data());
+    assert(std::abs(threeWayEquities[0] + threeWayEquities[1] +
+                    threeWayEquities[2] - 1.0) < 1e-9);
+    assert(threeWayEquities[0] > threeWayEquities[2]);
+
+    // Duplicate hole cards are rejected
+    std::array<aof::Card, 4> duplicated = {
+        aof::Card("A", "s"), aof::Card("A", "h"),
+        aof::Card("A", "s"), aof::Card("2", "d")
+    };
+    try {
+        engine.estimateEquities(duplicated.data(), 2, 100, 0, equities.data());
+        assert(false && "Should have thrown exception");
+    } catch (const std::invalid_argument&) {
+        // Expected
+    }
+
+    std::cout << "Board equity estimator tests passed!" << std::endl;
+}
+
+void testUndoAction() {
+    std::cout << "Testing action undo..." << std::endl;
+
+    aof::Game game(0.4, 1.0);
+    auto state = game.createInitialState();
+
+    // Deal, then fold/all-in with undo tokens
+    aof::GameState::UndoToken dealToken;
+    state->applyAction(aof::Action::DEAL, dealToken);
+    auto dealtHoleCards = state->getHoleCards();
+
+    aof::GameState::UndoToken foldToken;
+    double potBeforeFold = state->getPot();
+    state->applyAction(aof::Action::FOLD, foldToken);  // Player 2 folds
+
+    aof::GameState::UndoToken allInToken;
+    double stackBeforeAllIn = state->getPlayerStacks()[3];
+    state->applyAction(aof::Action::ALL_IN, allInToken);  // Player 3 all-in
+
+    // Undo all-in: pot, stack and all-in status should be restored
+    state->undoAction(allInToken);
+    assert(state->getCurrentPlayer() == 3);
+    assert(state->getPot() == potBeforeFold);
+    assert(state->getPlayerStacks()[3] == stackBeforeAllIn);
+    assert(!state->isAllIn(3));
+    (void)stackBeforeAllIn; (void)potBeforeFold; // Suppress unused variable warnings
+
+    // Undo fold: player 2 should be active again
+    state->undoAction(foldToken);
+    assert(state->getCurrentPlayer() == 2);
+    assert(!state->hasFolded(2));
+
+    // Undo deal: back to the chance node with a full deck, and re-dealing
+    // must produce the same hole cards
+    state->undoAction(dealToken);
+    assert(state->isChanceNode());
+    assert(state->getHoleCards().empty());
+
+    state->applyAction(aof::Action::DEAL);
+    assert(state->getHoleCards() == dealtHoleCards);
+
+    // Undo through a game-ending action: community cards must go back to
+    // the deck so the terminal outcome is reproducible
+    aof::GameState::UndoToken endTokens[3];
+    state->applyAction(aof::Action::FOLD, endTokens[0]);  // Player 2
+    state->applyAction(aof::Action::FOLD, endTokens[1]);  // Player 3
+    state->applyAction(aof::Action::FOLD, endTokens[2]);  // Player 0, ends game
+    assert(state->isTerminal());
+    auto firstReturns = state->getReturns();
+
+    state->undoAction(endTokens[2]);
+    assert(!state->isTerminal());
+    assert(state->getCommunityCards().empty());
+    assert(state->getCurrentPlayer() == 0);
+
+    state->applyAction(aof::Action::FOLD, endTokens[2]);
+    assert(state->isTerminal());
+    assert(state->getReturns() == firstReturns);
+
+    std::cout << "Action undo tests passed!" << std::endl;
+}
+
 void runGameStateTests() {
     try {
         testInitialState();
@@ -222,7 +402,10 @@ void runGameStateTests() {
         testGameTermination();
         testAllInScenario();
         testStateCloning();
-        
+        testEquityEngine();
+        testBoardEquityEstimator();
+        testUndoAction();
+
         std::cout << "\nAll game state tests passed successfully!" << std::endl;
         
     } catch (const std::exception& e) {
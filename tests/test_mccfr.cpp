@@ -1,10 +1,30 @@
 #include <iostream>
 #include <cassert>
 #include <cmath>
+#include <thread>
 #include "mccfr/node.hpp"
+#include "mccfr/flat_node_map.hpp"
+#include "mccfr/info_set_key.hpp"
+#include "mccfr/sharded_node_map.hpp"
+#include "mccfr/spsc_ring_buffer.hpp"
 #include "mccfr/utils.hpp"
 #include "mccfr/trainer.hpp"
+#include "mccfr/strategy_manager.hpp"
+#include "mccfr/mapped_strategy_file.hpp"
+#include "mccfr/strategy_query.hpp"
+#include "mccfr/best_response.hpp"
+#include "mccfr/distributed_sync.hpp"
+#include "mccfr/strategy_kernels.hpp"
+#include "mccfr/shm_telemetry.hpp"
+#include "mccfr/telemetry_log.hpp"
+#include "mccfr/sweep.hpp"
+#include <filesystem>
 #include "aof/game.hpp"
+#include "aof/profiling.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
 
 void testNode() {
     std::cout << "Testing MCCFR Node..." << std::endl;
@@ -41,10 +61,131 @@ void testNode() {
     auto resetStrategy = node.getStrategy(1.0);
     assert(std::abs(resetStrategy[0] - 0.5) < 0.001);
     assert(std::abs(resetStrategy[1] - 0.5) < 0.001);
-    
+
+    // Caller-buffer variants must agree with the vector-returning ones
+    node.updateRegret(1, 3.0);
+    auto vectorStrategy = node.getStrategy(1.0);
+    std::array<double, mccfr::Node::MAX_ACTIONS> buffer;
+    node.getStrategy(1.0, buffer.data());
+    assert(std::abs(buffer[0] - vectorStrategy[0]) < 1e-12);
+    assert(std::abs(buffer[1] - vectorStrategy[1]) < 1e-12);
+    node.getAverageStrategy(buffer.data());
+    auto vectorAverage = node.getAverageStrategy();
+    assert(std::abs(buffer[0] - vectorAverage[0]) < 1e-12);
+    assert(std::abs(buffer[1] - vectorAverage[1]) < 1e-12);
+
+    // Inline storage enforces the compile-time capacity
+    bool threw = false;
+    try {
+        mccfr::Node tooWide(mccfr::Node::MAX_ACTIONS + 1);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
     std::cout << "Node tests passed!" << std::endl;
 }
 
+void testUpdateRules() {
+    std::cout << "Testing CFR+ and discounted-CFR update rules..." << std::endl;
+
+    // CFR+ floors cumulative regret at zero
+    {
+        mccfr::Node node(2);
+        mccfr::UpdatePolicy policy;
+        policy.rule = mccfr::UpdateRule::CFR_PLUS;
+        policy.iteration = 1;
+
+        node.updateRegret(0, -5.0, policy);
+        node.updateRegret(1, 3.0, policy);
+        assert(node.getRegretSum()[0] == 0.0);
+        assert(node.getRegretSum()[1] == 3.0);
+
+        // The floor applies to the running sum, not the increment
+        node.updateRegret(1, -1.0, policy);
+        assert(node.getRegretSum()[1] == 2.0);
+        node.updateRegret(1, -10.0, policy);
+        assert(node.getRegretSum()[1] == 0.0);
+    }
+
+    // CFR+ weights strategy-sum contributions linearly by the iteration
+    {
+        mccfr::Node node(2);
+        mccfr::UpdatePolicy policy;
+        policy.rule = mccfr::UpdateRule::CFR_PLUS;
+
+        std::array<double, mccfr::Node::MAX_ACTIONS> strategy;
+        policy.iteration = 1;
+        node.getStrategy(1.0, strategy.data(), policy);
+        policy.iteration = 3;
+        node.getStrategy(1.0, strategy.data(), policy);
+
+        // Uniform strategy both times: weights 1 and 3 on 0.5 each
+        assert(std::abs(node.getStrategySum()[0] - 2.0) < 1e-12);
+        assert(std::abs(node.getStrategySum()[1] - 2.0) < 1e-12);
+    }
+
+    // Discounted CFR decays the sums once per touched iteration
+    {
+        mccfr::Node node(2);
+        node.updateRegret(0, 4.0);
+        node.updateRegret(1, -4.0);
+
+        mccfr::UpdatePolicy policy;
+        policy.rule = mccfr::UpdateRule::DISCOUNTED;
+        policy.iteration = 1;
+        policy.alpha = 1.5;
+        policy.beta = 0.0;
+        policy.gamma = 2.0;
+
+        std::array<double, mccfr::Node::MAX_ACTIONS> strategy;
+        node.getStrategy(1.0, strategy.data(), policy);
+
+        // t = 1: positive factor 1/2, negative factor (beta = 0) also 1/2
+        assert(std::abs(node.getRegretSum()[0] - 2.0) < 1e-12);
+        assert(std::abs(node.getRegretSum()[1] + 2.0) < 1e-12);
+
+        // A second touch in the same iteration must not discount again
+        double regret0 = node.getRegretSum()[0];
+        node.getStrategy(1.0, strategy.data(), policy);
+        assert(node.getRegretSum()[0] == regret0);
+        (void)regret0;
+    }
+
+    // Both variants train to valid distributions and to a profile in the
+    // same exploitability ballpark as vanilla CFR (under sampling none of
+    // the variants dominates at every budget, so no ordering is asserted)
+    aof::Game game(0.4, 1.0);
+    auto trainWith = [&](mccfr::UpdateRule rule) {
+        mccfr::Trainer trainer(game);
+        mccfr::TrainingConfig config;
+        config.iterations = 20000;
+        config.enableProgressOutput = false;
+        config.enableUtilityTracking = false;
+        config.outputPrefix = "test_update_rule";
+        config.rngSeed = 321;
+        config.updateRule = rule;
+        trainer.train(config);
+
+        for (const auto& [infoSet, strategy] : trainer.getAllStrategies()) {
+            double sum = strategy[0] + strategy[1];
+            assert(std::abs(sum - 1.0) < 0.001);
+            (void)sum;
+        }
+        return trainer.computeExploitability(2000, 1, 42).exploitability;
+    };
+
+    double vanilla = trainWith(mccfr::UpdateRule::VANILLA);
+    double cfrPlus = trainWith(mccfr::UpdateRule::CFR_PLUS);
+    double discounted = trainWith(mccfr::UpdateRule::DISCOUNTED);
+    assert(std::isfinite(vanilla) && vanilla > 0.0);
+    assert(cfrPlus < vanilla + 0.25);
+    assert(discounted < vanilla + 0.25);
+    (void)vanilla; (void)cfrPlus; (void)discounted;
+
+    std::cout << "Update rule tests passed!" << std::endl;
+}
+
 void testUtils() {
     std::cout << "Testing MCCFR utilities..." << std::endl;
     
@@ -85,6 +226,1427 @@ void testUtils() {
     std::cout << "Utils tests passed!" << std::endl;
 }
 
+void testShardedNodeMap() {
+    std::cout << "Testing sharded node map..." << std::endl;
+
+    mccfr::ShardedNodeMap nodes;
+
+    // Concurrent updates to many information sets from several threads
+    const int numThreads = 4;
+    const int updatesPerThread = 1000;
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < numThreads; ++t) {
+        workers.emplace_back([&]() {
+            for (int i = 0; i < updatesPerThread; ++i) {
+                mccfr::InfoSetKey key = static_cast<mccfr::InfoSetKey>(i % 50 + 1);
+                auto locked = nodes.getOrCreate(key, 2);
+                locked.node.getStrategy(1.0);
+                locked.node.updateRegret(i % 2, 1.0);
+            }
+        });
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    assert(nodes.size() == 50);
+
+    // Every update must be accounted for after merging
+    mccfr::FlatNodeMap merged;
+    nodes.mergeInto(merged);
+    assert(merged.size() == 50);
+    assert(nodes.size() == 0);
+
+    std::uint64_t totalVisits = 0;
+    merged.forEach([&totalVisits](mccfr::InfoSetKey, const mccfr::Node& node) {
+        totalVisits += node.getVisitCount();
+    });
+    assert(totalVisits == static_cast<std::uint64_t>(numThreads * updatesPerThread));
+
+    std::cout << "Sharded node map tests passed!" << std::endl;
+}
+
+void testFlatNodeMap() {
+    std::cout << "Testing flat node map..." << std::endl;
+
+    mccfr::FlatNodeMap nodes(16);
+
+    // Insert enough keys to force several growth steps
+    for (std::uint64_t key = 1; key <= 500; ++key) {
+        mccfr::Node& node = nodes.getOrCreate(key, 2);
+        node.updateRegret(0, static_cast<double>(key));
+    }
+
+    assert(nodes.size() == 500);
+
+    // Lookups must survive rehashing
+    for (std::uint64_t key = 1; key <= 500; ++key) {
+        const mccfr::Node* node = nodes.find(key);
+        assert(node != nullptr);
+        assert(std::abs(node->getRegretSum()[0] - static_cast<double>(key)) < 1e-12);
+        (void)node;
+    }
+    assert(nodes.find(10000) == nullptr);
+
+    // getOrCreate on an existing key must not reset the node
+    nodes.getOrCreate(42, 2);
+    assert(nodes.size() == 500);
+    assert(std::abs(nodes.find(42)->getRegretSum()[0] - 42.0) < 1e-12);
+
+    // eraseIf drops matching nodes and shrinks the slot array
+    std::size_t bytesBefore = nodes.memoryBytes();
+    assert(bytesBefore > 0);
+    std::size_t removed = nodes.eraseIf(
+        [](mccfr::InfoSetKey key, const mccfr::Node&) { return key > 100; });
+    assert(removed == 400);
+    assert(nodes.size() == 100);
+    assert(nodes.memoryBytes() < bytesBefore);
+    for (std::uint64_t key = 1; key <= 100; ++key) {
+        const mccfr::Node* node = nodes.find(key);
+        assert(node != nullptr);
+        assert(std::abs(node->getRegretSum()[0] - static_cast<double>(key)) < 1e-12);
+        (void)node;
+    }
+    assert(nodes.find(101) == nullptr);
+
+    nodes.clear();
+    assert(nodes.empty());
+
+    std::cout << "Flat node map tests passed!" << std::endl;
+}
+
+void testInfoSetKey() {
+    std::cout << "Testing packed information set keys..." << std::endl;
+
+    aof::Game game(0.4, 1.0);
+    auto state = game.createInitialState();
+    state->applyAction(aof::Action::DEAL);
+
+    // Encoded key must decode to exactly the legacy string form
+    for (int player = 0; player < 4; ++player) {
+        std::string expected = mccfr::utils::getInformationSet(*state, player);
+        mccfr::InfoSetKey key = mccfr::utils::encodeInfoSet(*state, player);
+        assert(mccfr::utils::decodeInfoSetString(key) == expected);
+
+        // And the string must parse back to the same key
+        mccfr::InfoSetKey parsed = 0;
+        assert(mccfr::utils::parseInfoSetString(expected, parsed));
+        assert(parsed == key);
+        (void)expected; (void)parsed;
+    }
+
+    // Keys must track state changes the same way the strings do
+    mccfr::InfoSetKey before = mccfr::utils::encodeInfoSet(*state, 3);
+    state->applyAction(aof::Action::FOLD);  // Player 2 folds
+    mccfr::InfoSetKey after = mccfr::utils::encodeInfoSet(*state, 3);
+    assert(before != after);
+    assert(mccfr::utils::decodeInfoSetString(after) ==
+           mccfr::utils::getInformationSet(*state, 3));
+
+    std::cout << "Packed information set key tests passed!" << std::endl;
+}
+
+void testSpscRingBuffer() {
+    std::cout << "Testing SPSC ring buffer..." << std::endl;
+
+    // FIFO order within capacity
+    mccfr::SpscRingBuffer<int, 8> buffer;
+    int value = 0;
+    assert(!buffer.tryPop(value));
+    assert(buffer.empty());
+
+    for (int i = 0; i < 5; ++i) {
+        buffer.push(i);
+    }
+    for (int i = 0; i < 5; ++i) {
+        assert(buffer.tryPop(value));
+        assert(value == i);
+    }
+    assert(!buffer.tryPop(value));
+
+    // Overflow drops the oldest entries, never blocks the producer
+    for (int i = 0; i < 20; ++i) {
+        buffer.push(i);
+    }
+    assert(buffer.tryPop(value));
+    assert(value == 12);  // 20 pushed into 8 slots: 0-11 dropped
+    int last = value;
+    while (buffer.tryPop(value)) {
+        assert(value == last + 1);
+        last = value;
+    }
+    assert(last == 19);
+    assert(buffer.droppedCount() == 12);
+
+    // Concurrent smoke test: consumer sees a strictly increasing
+    // subsequence of what the producer wrote
+    mccfr::SpscRingBuffer<std::uint64_t, 256> shared;
+    std::atomic<bool> done{false};
+
+    std::thread consumer([&]() {
+        std::uint64_t previous = 0;
+        std::uint64_t item = 0;
+        for (;;) {
+            if (shared.tryPop(item)) {
+                assert(item > previous);
+                previous = item;
+            } else if (done.load()) {
+                break;
+            }
+        }
+    });
+
+    for (std::uint64_t i = 1; i <= 100000; ++i) {
+        shared.push(i);
+    }
+    done.store(true);
+    consumer.join();
+
+    std::cout << "SPSC ring buffer tests passed!" << std::endl;
+}
+
+void testOutcomeSampling() {
+    std::cout << "Testing outcome-sampling MCCFR..." << std::endl;
+
+    aof::Game game(0.4, 1.0);
+    mccfr::Trainer trainer(game);
+
+    mccfr::TrainingConfig config;
+    config.iterations = 2000;
+    config.samplingScheme = mccfr::SamplingScheme::OUTCOME;
+    config.enableProgressOutput = false;
+    config.enableUtilityTracking = false;
+    config.outputPrefix = "test_outcome_strategy";
+
+    auto utilities = trainer.train(config);
+    assert(utilities.size() == 4);
+
+    auto stats = trainer.getStats();
+    assert(stats.totalIterations == 2000);
+    assert(stats.informationSetsCount > 0);
+
+    // Sampled updates must still produce valid probability distributions
+    for (const auto& [infoSet, strategy] : trainer.getAllStrategies()) {
+        assert(strategy.size() == 2);
+        double sum = strategy[0] + strategy[1];
+        assert(std::abs(sum - 1.0) < 0.001);
+        (void)sum;
+    }
+
+    std::cout << "Outcome sampling tests passed!" << std::endl;
+}
+
+void testBinaryStrategyFile() {
+    std::cout << "Testing binary strategy file..." << std::endl;
+
+    // Train briefly so there are real strategies to round-trip
+    aof::Game game(0.4, 1.0);
+    mccfr::Trainer trainer(game);
+
+    mccfr::TrainingConfig config;
+    config.iterations = 200;
+    config.enableProgressOutput = false;
+    config.enableUtilityTracking = false;
+    config.outputPrefix = "test_binary_strategy";
+    trainer.train(config);
+
+    auto strategies = trainer.getAllStrategies();
+    assert(!strategies.empty());
+
+    // Feed the manager through the existing text path, then write binary
+    mccfr::StrategyManager manager;
+    const std::string filename = "test_binary_strategy.bin";
+    trainer.saveStrategies("test_binary_strategy.txt");
+    assert(manager.loadFromFile("test_binary_strategy.txt"));
+    assert(manager.saveToBinary(filename));
+
+    // loadFromBinary must reconstruct the same strategies
+    mccfr::StrategyManager reloaded;
+    assert(reloaded.loadFromBinary(filename));
+    assert(reloaded.size() == manager.size());
+    for (const auto& [infoSet, strategy] : manager.getAllStrategies()) {
+        auto roundTripped = reloaded.getStrategy(infoSet);
+        assert(roundTripped.size() == strategy.size());
+        for (std::size_t i = 0; i < strategy.size(); ++i) {
+            assert(std::abs(roundTripped[i] - strategy[i]) < 1e-12);
+        }
+    }
+
+    // The mmap view must serve the same lookups with no load step
+    mccfr::MappedStrategyFile mapped;
+    assert(mapped.open(filename));
+    assert(mapped.size() == manager.size());
+    assert(mapped.numActions() == 2);
+
+    for (const auto& [infoSet, strategy] : manager.getAllStrategies()) {
+        mccfr::InfoSetKey key = 0;
+        assert(mccfr::utils::parseInfoSetString(infoSet, key));
+
+        const double* probs = mapped.findStrategy(key);
+        assert(probs != nullptr);
+        for (std::size_t i = 0; i < strategy.size(); ++i) {
+            assert(std::abs(probs[i] - strategy[i]) < 1e-12);
+        }
+
+        auto byString = mapped.getStrategy(infoSet);
+        assert(byString.size() == strategy.size());
+        (void)byString;
+    }
+
+    // Unknown keys must miss cleanly
+    assert(mapped.findStrategy(~mccfr::InfoSetKey{0}) == nullptr);
+    mapped.close();
+    assert(!mapped.isOpen());
+
+    std::remove("test_binary_strategy.txt");
+    std::remove(filename.c_str());
+
+    std::cout << "Binary strategy file tests passed!" << std::endl;
+}
+
+void testStrategyAnalytics() {
+    std::cout << "Testing indexed strategy analytics..." << std::endl;
+
+    aof::Game game(0.4, 1.0);
+    mccfr::Trainer trainer(game);
+
+    mccfr::TrainingConfig config;
+    config.iterations = 2000;
+    config.rngSeed = 777;
+    config.enableProgressOutput = false;
+    config.enableUtilityTracking = false;
+    config.enableDataLogging = false;
+    config.outputPrefix = "test_analytics_strategy";
+    trainer.train(config);
+
+    mccfr::StrategyManager manager;
+    trainer.saveStrategies("test_analytics_strategy.txt");
+    assert(manager.loadFromFile("test_analytics_strategy.txt"));
+    const std::string filename = "test_analytics_strategy.bin";
+    assert(manager.saveToBinary(filename));
+
+    mccfr::MappedStrategyFile mapped;
+    assert(mapped.open(filename));
+    assert(mapped.hasAnalyticsIndex());
+
+    // Top-K must reproduce the manager's visit-sorted prefix
+    auto expectedOrder = manager.getInfoSetsByVisitCount(true);
+    auto top = mapped.topByVisits(25);
+    assert(top.size() == std::min<std::size_t>(25, expectedOrder.size()));
+    for (std::size_t i = 0; i < top.size(); ++i) {
+        assert(top[i].visitCount == expectedOrder[i].second);
+        if (i > 0) {
+            assert(top[i].visitCount <= top[i - 1].visitCount);
+        }
+    }
+    assert(mapped.topByVisits(mapped.size() + 50).size() == mapped.size());
+
+    // Filtered views must agree with a brute-force scan of the manager
+    auto countMatching = [&](int position, int bucket, double minPot) {
+        std::size_t count = 0;
+        for (const auto& [infoSet, strategy] : manager.getAllStrategies()) {
+            mccfr::InfoSetKey key = 0;
+            assert(mccfr::utils::parseInfoSetString(infoSet, key));
+            if ((position < 0 || mccfr::utils::keyPosition(key) == position) &&
+                (bucket < 0 || mccfr::utils::keyBucket(key) == bucket) &&
+                mccfr::utils::keyPot(key) >= minPot) {
+                ++count;
+            }
+            (void)strategy;
+        }
+        return count;
+    };
+
+    auto checkFilter = [&](int position, int bucket, double minPot) {
+        auto entries = mapped.filterEntries(position, bucket, minPot);
+        assert(entries.size() == countMatching(position, bucket, minPot));
+        for (const auto& entry : entries) {
+            assert(position < 0 || mccfr::utils::keyPosition(entry.key) == position);
+            assert(bucket < 0 || mccfr::utils::keyBucket(entry.key) == bucket);
+            assert(mccfr::utils::keyPot(entry.key) >= minPot);
+            assert(entry.strategy != nullptr);
+        }
+    };
+
+    int sampleBucket = mccfr::utils::keyBucket(top[0].key);
+    checkFilter(3, -1, 0.0);           // every BTN decision point
+    checkFilter(3, -1, 3.0);           // BTN with a meaningful pot
+    checkFilter(-1, sampleBucket, 0.0);  // one bucket across positions
+    checkFilter(2, sampleBucket, 1.0);   // position and bucket combined
+    checkFilter(-1, -1, 0.0);          // unfiltered (full field order)
+
+    // Per-bucket aggregate must match a direct scan
+    auto allInByBucket = mapped.averageActionFrequencyByBucket(1);
+    assert(allInByBucket.size() == 169);
+    {
+        double sum = 0.0;
+        std::size_t count = 0;
+        for (const auto& [infoSet, strategy] : manager.getAllStrategies()) {
+            mccfr::InfoSetKey key = 0;
+            assert(mccfr::utils::parseInfoSetString(infoSet, key));
+            if (mccfr::utils::keyBucket(key) == sampleBucket) {
+                sum += strategy[1];
+                ++count;
+            }
+        }
+        assert(count > 0);
+        assert(std::abs(allInByBucket[sampleBucket] - sum / count) < 1e-12);
+    }
+    for (double average : allInByBucket) {
+        assert(average >= 0.0 && average <= 1.0);
+        (void)average;
+    }
+
+    // A file without the index (pre-index layout) must open and degrade
+    // gracefully: zero the analytics offset in a copy
+    {
+        std::ifstream in(filename, std::ios::binary);
+        std::vector<char> bytes((std::istreambuf_iterator<char>(in)),
+                                std::istreambuf_iterator<char>());
+        in.close();
+        mccfr::strategy_file::Header header{};
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        header.analyticsOffset = 0;
+        std::memcpy(bytes.data(), &header, sizeof(header));
+        std::ofstream out("test_analytics_legacy.bin", std::ios::binary);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        out.close();
+
+        mccfr::MappedStrategyFile legacy;
+        assert(legacy.open("test_analytics_legacy.bin"));
+        assert(!legacy.hasAnalyticsIndex());
+        assert(legacy.topByVisits(5).empty());
+        assert(legacy.filterEntries(0, -1).empty());
+        assert(legacy.findStrategy(top[0].key) != nullptr);
+        legacy.close();
+        std::remove("test_analytics_legacy.bin");
+    }
+
+    mapped.close();
+    std::remove("test_analytics_strategy.txt");
+    std::remove(filename.c_str());
+
+    std::cout << "Indexed strategy analytics tests passed!" << std::endl;
+}
+
+void testStrategyQuery() {
+    std::cout << "Testing strategy query table..." << std::endl;
+
+    // The structured encoder must agree with the GameState one
+    aof::Game game(0.4, 1.0);
+    auto state = game.createInitialState();
+    state->applyAction(aof::Action::DEAL);
+    int player = state->getCurrentPlayer();
+    const auto& holeCards = state->getHoleCards();
+
+    mccfr::InfoSetKey stateKey = mccfr::utils::encodeInfoSet(*state, player);
+    mccfr::InfoSetKey structuredKey = mccfr::utils::encodeInfoSet(
+        player, state->getFoldedMask(), state->getAllInMask(),
+        holeCards[player * 2], holeCards[player * 2 + 1], state->getPot());
+    assert(stateKey == structuredKey);
+
+    // Train briefly and push the result through the binary file path
+    mccfr::Trainer trainer(game);
+    mccfr::TrainingConfig config;
+    config.iterations = 300;
+    config.enableProgressOutput = false;
+    config.enableUtilityTracking = false;
+    config.outputPrefix = "test_query_strategy";
+    trainer.train(config);
+
+    mccfr::StrategyManager manager;
+    trainer.saveStrategies("test_query_strategy.txt");
+    assert(manager.loadFromFile("test_query_strategy.txt"));
+    assert(manager.saveToBinary("test_query_strategy.bin"));
+
+    mccfr::StrategyQueryTable table;
+    assert(table.loadFromBinary("test_query_strategy.bin"));
+    assert(table.size() > 0);
+    assert(table.numActions() == 2);
+
+    // Every stored strategy must resolve through the perfect hash
+    std::size_t resolved = 0;
+    for (const auto& [infoSet, strategy] : manager.getAllStrategies()) {
+        mccfr::InfoSetKey key = 0;
+        if (!mccfr::utils::parseInfoSetString(infoSet, key)) continue;
+
+        std::array<double, mccfr::Node::MAX_ACTIONS> probs{};
+        assert(table.lookup(key, probs.data()) == 2);
+        for (std::size_t i = 0; i < strategy.size(); ++i) {
+            assert(std::abs(probs[i] - strategy[i]) < 1e-12);
+        }
+        ++resolved;
+    }
+    assert(resolved == table.size());
+
+    // Unknown decision points must miss cleanly
+    std::array<double, mccfr::Node::MAX_ACTIONS> probs{};
+    assert(table.lookup(mccfr::InfoSetKey{0}, probs.data()) == 0);
+
+    // Structured queries resolve to the same distribution as their key
+    mccfr::StrategyQuery query;
+    query.player = player;
+    query.foldedMask = state->getFoldedMask();
+    query.allInMask = state->getAllInMask();
+    query.holeCard1 = holeCards[player * 2];
+    query.holeCard2 = holeCards[player * 2 + 1];
+    query.pot = state->getPot();
+
+    std::array<double, mccfr::Node::MAX_ACTIONS> byQuery{};
+    std::array<double, mccfr::Node::MAX_ACTIONS> byKey{};
+    int queryCount = table.lookup(query, byQuery.data());
+    int keyCount = table.lookup(structuredKey, byKey.data());
+    assert(queryCount == keyCount);
+    for (int i = 0; i < queryCount; ++i) {
+        assert(byQuery[i] == byKey[i]);
+    }
+
+    // Building from the manager directly gives the same table
+    mccfr::StrategyQueryTable rebuilt;
+    rebuilt.build(manager);
+    assert(rebuilt.size() == table.size());
+    for (const auto& [infoSet, strategy] : manager.getAllStrategies()) {
+        mccfr::InfoSetKey key = 0;
+        if (!mccfr::utils::parseInfoSetString(infoSet, key)) continue;
+        std::array<double, mccfr::Node::MAX_ACTIONS> fromRebuilt{};
+        assert(rebuilt.lookup(key, fromRebuilt.data()) == 2);
+        assert(std::abs(fromRebuilt[0] - strategy[0]) < 1e-12);
+    }
+
+    std::remove("test_query_strategy.txt");
+    std::remove("test_query_strategy.bin");
+
+    std::cout << "Strategy query table tests passed!" << std::endl;
+}
+
+void testStrategyKernels() {
+    std::cout << "Testing batched strategy kernels..." << std::endl;
+
+    // Regret matching: clamp to positive, normalize, uniform fallback.
+    // Odd row count exercises the vectorized path's scalar tail.
+    double regrets[] = {
+        3.0, -1.0,     // -> {1, 0}
+        -2.0, -3.0,    // -> {0.5, 0.5}
+        1.0, 3.0       // -> {0.25, 0.75}
+    };
+    mccfr::kernels::regretMatchRows(regrets, 3, 2);
+    assert(std::abs(regrets[0] - 1.0) < 1e-12 && std::abs(regrets[1]) < 1e-12);
+    assert(std::abs(regrets[2] - 0.5) < 1e-12 && std::abs(regrets[3] - 0.5) < 1e-12);
+    assert(std::abs(regrets[4] - 0.25) < 1e-12 && std::abs(regrets[5] - 0.75) < 1e-12);
+
+    // Average strategies: plain normalization with uniform fallback
+    double sums[] = {
+        2.0, 6.0,      // -> {0.25, 0.75}
+        0.0, 0.0       // -> {0.5, 0.5}
+    };
+    mccfr::kernels::averageStrategyRows(sums, 2, 2);
+    assert(std::abs(sums[0] - 0.25) < 1e-12 && std::abs(sums[1] - 0.75) < 1e-12);
+    assert(std::abs(sums[2] - 0.5) < 1e-12 && std::abs(sums[3] - 0.5) < 1e-12);
+
+    // Three-action rows take the generic path
+    double wide[] = {1.0, -1.0, 3.0};
+    mccfr::kernels::regretMatchRows(wide, 1, 3);
+    assert(std::abs(wide[0] - 0.25) < 1e-12 && std::abs(wide[1]) < 1e-12 &&
+           std::abs(wide[2] - 0.75) < 1e-12);
+
+    // Kernel output matches the per-node path bit for bit
+    mccfr::Node node(2);
+    node.updateRegret(0, 1.25);
+    node.updateRegret(1, 4.75);
+    node.getStrategy(1.0);
+    auto perNode = node.getAverageStrategy();
+    double batched[2] = {node.getStrategySum()[0], node.getStrategySum()[1]};
+    mccfr::kernels::averageStrategyRows(batched, 1, 2);
+    assert(batched[0] == perNode[0] && batched[1] == perNode[1]);
+
+    // StrategyManager's flat-map loader goes through the batched path
+    mccfr::FlatNodeMap nodeMap;
+    mccfr::Node& mapped = nodeMap.getOrCreate(42, 2);
+    mapped.updateRegret(0, 1.25);
+    mapped.updateRegret(1, 4.75);
+    mapped.getStrategy(1.0);
+    mccfr::StrategyManager manager;
+    manager.loadFromNodeMap(nodeMap);
+    auto loaded = manager.getStrategy(mccfr::utils::decodeInfoSetString(42));
+    assert(loaded.size() == 2);
+    assert(loaded[0] == perNode[0] && loaded[1] == perNode[1]);
+
+    std::cout << "Strategy kernel tests passed!" << std::endl;
+}
+
+void testDistributedSync() {
+    std::cout << "Testing distributed regret sync..." << std::endl;
+
+    const std::string dir = "test_sync_dir";
+    std::filesystem::remove_all(dir);
+
+    mccfr::DistributedSync worker0(dir, 0);
+    mccfr::DistributedSync worker1(dir, 1);
+
+    mccfr::FlatNodeMap map0;
+    mccfr::FlatNodeMap map1;
+
+    double regrets[2] = {1.5, -0.5};
+    double strategies[2] = {0.25, 0.75};
+    map0.getOrCreate(101, 2).accumulate(regrets, strategies, 7);
+    double regrets2[2] = {2.0, 3.0};
+    map0.getOrCreate(202, 2).accumulate(regrets2, strategies, 4);
+
+    // Worker 0 publishes its progress; worker 1 merges it exactly once
+    assert(worker0.publishDelta(map0) == 2);
+    assert(worker1.mergeRemoteDeltas(map1) == 1);
+
+    const mccfr::Node* merged = map1.find(101);
+    assert(merged != nullptr);
+    assert(merged->getVisitCount() == 7);
+    assert(std::abs(merged->getRegretSum()[0] - 1.5) < 1e-12);
+    assert(std::abs(merged->getStrategySum()[1] - 0.75) < 1e-12);
+    assert(worker1.mergeRemoteDeltas(map1) == 0);
+
+    // Unchanged maps publish empty deltas, and merged remote sums are
+    // not re-published as the merging worker's own progress
+    assert(worker0.publishDelta(map0) == 0);
+    assert(worker1.publishDelta(map1) == 0);
+    worker0.mergeRemoteDeltas(map0);
+    assert(map0.find(101)->getVisitCount() == 7);  // No double count
+
+    // New local progress on top of merged state round-trips back
+    double moreRegrets[2] = {0.5, 0.5};
+    map1.getOrCreate(101, 2).accumulate(moreRegrets, strategies, 3);
+    assert(worker1.publishDelta(map1) == 1);
+    worker0.mergeRemoteDeltas(map0);
+    assert(map0.find(101)->getVisitCount() == 10);
+    assert(std::abs(map0.find(101)->getRegretSum()[0] - 2.0) < 1e-12);
+
+    // Trainer wiring: a synced run trains normally and leaves delta files
+    aof::Game game(0.4, 1.0);
+    mccfr::Trainer trainer(game);
+
+    mccfr::TrainingConfig config;
+    config.iterations = 300;
+    config.syncDirectory = dir;
+    config.syncWorkerId = 2;
+    config.syncInterval = 100;
+    config.enableProgressOutput = false;
+    config.enableUtilityTracking = false;
+    config.outputPrefix = "test_sync_strategy";
+
+    trainer.train(config);
+    assert(std::filesystem::exists(dir + "/regrets_w2_e0.bin"));
+
+    std::filesystem::remove_all(dir);
+
+    std::cout << "Distributed sync tests passed!" << std::endl;
+}
+
+void testCheckpointing() {
+    std::cout << "Testing asynchronous checkpointing..." << std::endl;
+
+    aof::Game game(0.4, 1.0);
+    mccfr::Trainer trainer(game);
+
+    mccfr::TrainingConfig config;
+    config.iterations = 1000;
+    config.checkpointInterval = 200;
+    config.checkpointsToKeep = 2;
+    config.enableProgressOutput = false;
+    config.enableUtilityTracking = false;
+    config.outputPrefix = "test_checkpoint_strategy";
+
+    trainer.train(config);
+
+    auto checkpointExists = [](int iteration) {
+        std::string name = "test_checkpoint_strategy_checkpoint_" +
+                           std::to_string(iteration) + ".txt";
+        std::ifstream file(name);
+        return file.good();
+    };
+
+    // Checkpoints fire at 200/400/600/800 (the final save covers 1000);
+    // rotation keeps only the newest two on disk
+    assert(!checkpointExists(200));
+    assert(!checkpointExists(400));
+    assert(checkpointExists(600));
+    assert(checkpointExists(800));
+
+    // The latest checkpoint must be loadable like any strategy file
+    mccfr::Trainer restored(game);
+    assert(restored.loadStrategies("test_checkpoint_strategy_checkpoint_800.txt"));
+    assert(!restored.getAllStrategies().empty());
+
+    // Each checkpoint also refreshes the lossless resume file
+    {
+        std::ifstream resumeCkpt("test_checkpoint_strategy_resume.ckpt");
+        assert(resumeCkpt.good());
+    }
+
+    std::remove("test_checkpoint_strategy_checkpoint_600.txt");
+    std::remove("test_checkpoint_strategy_checkpoint_800.txt");
+    std::remove("test_checkpoint_strategy_resume.ckpt");
+
+    std::cout << "Checkpointing tests passed!" << std::endl;
+}
+
+void testResume() {
+    std::cout << "Testing lossless checkpoint resume..." << std::endl;
+
+    aof::Game game(0.4, 1.0);
+
+    auto makeConfig = [](int iterations) {
+        mccfr::TrainingConfig config;
+        config.iterations = iterations;
+        config.rngSeed = 777;
+        config.enableProgressOutput = false;
+        config.enableUtilityTracking = false;
+        config.outputPrefix = "test_resume_strategy";
+        return config;
+    };
+
+    // Reference: one uninterrupted seeded run
+    mccfr::Trainer reference(game);
+    reference.train(makeConfig(600));
+    auto referenceStrategies = reference.getAllStrategies();
+    auto referenceUtilities = reference.getStats().finalUtilities;
+
+    // Same run split in two: train halfway, checkpoint, resume in a fresh
+    // trainer. The checkpoint carries the exact node sums, iteration
+    // count, accumulated utilities and RNG state, so the resumed half
+    // must replay the reference bit-for-bit.
+    mccfr::Trainer first(game);
+    first.train(makeConfig(300));
+    assert(first.saveCheckpoint("test_resume.ckpt"));
+
+    mccfr::Trainer second(game);
+    assert(second.loadCheckpoint("test_resume.ckpt"));
+    second.train(makeConfig(600));
+
+    assert(second.getStats().totalIterations == 600);
+    auto resumedStrategies = second.getAllStrategies();
+    assert(resumedStrategies.size() == referenceStrategies.size());
+    for (const auto& [infoSet, strategy] : referenceStrategies) {
+        auto it = resumedStrategies.find(infoSet);
+        assert(it != resumedStrategies.end());
+        assert(it->second == strategy);  // exact, not approximate
+    }
+    auto resumedUtilities = second.getStats().finalUtilities;
+    assert(resumedUtilities == referenceUtilities);
+
+    // A corrupt or non-checkpoint file is rejected cleanly
+    mccfr::Trainer rejecting(game);
+    assert(!rejecting.loadCheckpoint("test_resume_missing.ckpt"));
+    {
+        std::ofstream bogus("test_resume_bogus.ckpt", std::ios::binary);
+        bogus << "not a checkpoint";
+    }
+    assert(!rejecting.loadCheckpoint("test_resume_bogus.ckpt"));
+
+    std::remove("test_resume.ckpt");
+    std::remove("test_resume_bogus.ckpt");
+
+    std::cout << "Resume tests passed!" << std::endl;
+}
+
+void testSweep() {
+    std::cout << "Testing multi-configuration sweep..." << std::endl;
+
+    {
+        std::ofstream file("test_sweep.cfg");
+        file << "# name smallBlind bigBlind iterations [stacks in BB]\n";
+        file << "micro 0.4 1.0 300\n";
+        file << "deep 0.5 1.0 300 12 12 12 12\n";
+        file << "\n";
+        file << "tiny 0.2 0.5 200\n";
+    }
+
+    auto entries = mccfr::SweepRunner::loadSweepFile("test_sweep.cfg");
+    assert(entries.size() == 3);
+    assert(entries[0].stacksBB.empty());
+    assert(entries[1].stacksBB.size() == 4);
+    assert(entries[1].stacksBB[0] == 12.0);
+    assert(entries[2].iterations == 200);
+
+    mccfr::SweepRunner::Options options;
+    options.numWorkers = 2;
+    options.outputPrefix = "test_sweep";
+    options.rngSeed = 42;
+    options.evaluationDeals = 500;
+    options.enableProgressOutput = false;
+
+    mccfr::SweepRunner runner;
+    auto results = runner.run(entries, options);
+    assert(results.size() == 3);
+    for (const auto& result : results) {
+        assert(result.succeeded);
+        assert(result.informationSets > 0);
+        assert(result.finalUtilities.size() ==
+               static_cast<std::size_t>(aof::GameConfig::NUM_PLAYERS));
+        assert(result.exploitability >= 0.0);
+    }
+
+    // The summary carries one row per configuration
+    {
+        std::ifstream summary("test_sweep_sweep_summary.csv");
+        assert(summary.good());
+        std::string line;
+        assert(std::getline(summary, line));
+        assert(line.rfind("name,small_blind", 0) == 0);
+        int rows = 0;
+        while (std::getline(summary, line)) {
+            ++rows;
+        }
+        assert(rows == 3);
+    }
+
+    // Malformed sweep files are rejected with context, not half-parsed
+    {
+        std::ofstream file("test_sweep_bad.cfg");
+        file << "broken 0.4\n";
+    }
+    bool threw = false;
+    try {
+        mccfr::SweepRunner::loadSweepFile("test_sweep_bad.cfg");
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::remove("test_sweep.cfg");
+    std::remove("test_sweep_bad.cfg");
+    std::remove("test_sweep_sweep_summary.csv");
+
+    std::cout << "Sweep tests passed!" << std::endl;
+}
+
+void testShmTelemetry() {
+    std::cout << "Testing shared-memory telemetry ring..." << std::endl;
+
+    const std::string ringFile = "test_telemetry.ring";
+    std::vector<double> utilities = {0.25, -0.5, 0.75, -0.5};
+
+    mccfr::shm_telemetry::ShmTelemetryWriter writer;
+    assert(writer.create(ringFile, 8));
+    assert(writer.isOpen());
+
+    // Records round-trip through the mapping intact and in order
+    for (int i = 1; i <= 5; ++i) {
+        mccfr::TrainingDataPoint point(i * 10, 0.01 * i, 0.001 * i, utilities,
+                                       std::chrono::milliseconds(100 * i));
+        writer.publish(point);
+    }
+    assert(writer.published() == 5);
+
+    mccfr::shm_telemetry::ShmTelemetryReader reader;
+    assert(reader.open(ringFile));
+    for (int i = 1; i <= 5; ++i) {
+        mccfr::TrainingDataPoint point;
+        assert(reader.poll(point));
+        assert(point.iteration == i * 10);
+        assert(point.meanAbsoluteError == 0.01 * i);
+        assert(point.utilitySum == 0.001 * i);
+        assert(point.numPlayers == static_cast<std::int32_t>(utilities.size()));
+        for (std::int32_t p = 0; p < point.numPlayers; ++p) {
+            assert(point.playerUtilities[p] == utilities[p]);
+        }
+        assert(point.elapsedMs == 100 * i);
+    }
+    mccfr::TrainingDataPoint point;
+    assert(!reader.poll(point));
+
+    // A lapped reader skips to the intact window and reports the loss
+    for (int i = 6; i <= 25; ++i) {
+        writer.publish(mccfr::TrainingDataPoint(
+            i * 10, 0.01 * i, 0.001 * i, utilities, std::chrono::milliseconds(0)));
+    }
+    assert(reader.poll(point));
+    assert(reader.droppedRecords() > 0);
+    assert(point.iteration > 50);
+    int lastIteration = point.iteration;
+    while (reader.poll(point)) {
+        assert(point.iteration == lastIteration + 10);
+        lastIteration = point.iteration;
+    }
+    assert(lastIteration == 250);
+
+    // A reader attaching mid-run starts at the oldest intact record
+    mccfr::shm_telemetry::ShmTelemetryReader lateReader;
+    assert(lateReader.open(ringFile));
+    int lateCount = 0;
+    while (lateReader.poll(point)) {
+        ++lateCount;
+        lastIteration = point.iteration;
+    }
+    assert(lateCount > 0 && lateCount <= 8);
+    assert(lastIteration == 250);
+
+    writer.close();
+    assert(!writer.isOpen());
+
+    // Files that are not telemetry rings are rejected up front
+    {
+        std::ofstream bogus("test_telemetry_bad.ring");
+        bogus << "not a telemetry ring";
+    }
+    mccfr::shm_telemetry::ShmTelemetryReader badReader;
+    assert(!badReader.open("test_telemetry_bad.ring"));
+    assert(!badReader.open("test_telemetry_missing.ring"));
+
+    std::remove(ringFile.c_str());
+    std::remove("test_telemetry_bad.ring");
+
+    std::cout << "Shared-memory telemetry tests passed!" << std::endl;
+}
+
+void testTelemetryLog() {
+    std::cout << "Testing telemetry log..." << std::endl;
+
+    using mccfr::telemetry_log::TelemetryLogWriter;
+    using mccfr::telemetry_log::TelemetryRecord;
+
+    const std::string logFile = "test_telemetry_log.bin";
+
+    // Converts a segment to CSV and returns its data row count (-1 when
+    // the segment is missing or invalid)
+    auto countRows = [](const std::string& file) -> int {
+        const std::string csvFile = file + ".csv";
+        if (!mccfr::telemetry_log::exportCsv(file, csvFile)) {
+            return -1;
+        }
+        std::ifstream csv(csvFile);
+        std::string line;
+        int rows = -1;        // Discount the header row
+        while (std::getline(csv, line)) {
+            ++rows;
+        }
+        std::remove(csvFile.c_str());
+        return rows;
+    };
+
+    // Direct writer with tiny segments so rotation must trigger; enough
+    // rotated slots that no records are dropped regardless of how the
+    // background thread batches its writes
+    TelemetryLogWriter writer;
+    TelemetryLogWriter::Options options;
+    options.maxFileBytes = 64 + 30 * sizeof(TelemetryRecord);
+    options.rotatedFilesToKeep = 4;
+    options.fsyncIntervalMs = 10;
+    assert(writer.open(logFile, options));
+    assert(writer.isOpen());
+
+    std::vector<double> utilities = {0.25, -0.5, 0.75, -0.5};
+    for (int i = 1; i <= 100; ++i) {
+        TelemetryRecord record;
+        record.iteration = i;
+        record.elapsedMs = 10 * i;
+        record.nodeCount = 1000 + i;
+        record.iterationsPerSecond = 100.0;
+        record.meanAbsoluteError = 1.0 / i;
+        for (std::size_t p = 0; p < utilities.size(); ++p) {
+            record.playerUtilities[p] = utilities[p];
+        }
+        writer.append(record);
+    }
+    writer.close();
+    assert(!writer.isOpen());
+    assert(writer.recordsWritten() == 100);
+
+    // 100 records at 80 bytes overflow the segment limit, so at least
+    // one rotation happened and every record survives across segments
+    int liveRows = countRows(logFile);
+    assert(liveRows >= 0);
+    int rotatedRows = 0;
+    int rotatedSegments = 0;
+    for (int i = 1; i <= options.rotatedFilesToKeep; ++i) {
+        int rows = countRows(logFile + "." + std::to_string(i));
+        if (rows >= 0) {
+            ++rotatedSegments;
+            rotatedRows += rows;
+        }
+    }
+    assert(rotatedSegments >= 1);
+    assert(liveRows + rotatedRows == 100);
+
+    // Files that are not telemetry logs are rejected up front
+    {
+        std::ofstream bogus("test_telemetry_log_bad.bin");
+        bogus << "not a telemetry log";
+    }
+    assert(countRows("test_telemetry_log_bad.bin") == -1);
+    assert(countRows("test_telemetry_log_missing.bin") == -1);
+    std::remove("test_telemetry_log_bad.bin");
+
+    // End-to-end: a training run streams records that convert cleanly
+    // (open() rotates the direct-writer segment out of the way first)
+    aof::Game game(0.4, 1.0);
+    mccfr::Trainer trainer(game);
+
+    mccfr::TrainingConfig config;
+    config.iterations = 1000;
+    config.enableProgressOutput = false;
+    config.enableUtilityTracking = false;
+    config.rngSeed = 555;
+    config.outputPrefix = "test_telemetry_strategy";
+    config.enableDataLogging = true;
+    config.dataLogFile = logFile;
+    config.dataLogInterval = 10;
+    trainer.train(config);
+
+    assert(countRows(logFile) == 100);     // One record every 10 iterations
+
+    std::remove(logFile.c_str());
+    for (int i = 1; i <= options.rotatedFilesToKeep + 1; ++i) {
+        std::remove((logFile + "." + std::to_string(i)).c_str());
+    }
+
+    std::cout << "Telemetry log tests passed!" << std::endl;
+}
+
+void testPruning() {
+    std::cout << "Testing regret-based pruning..." << std::endl;
+
+    aof::Game game(0.4, 1.0);
+
+    auto makeConfig = [](int iterations) {
+        mccfr::TrainingConfig config;
+        config.iterations = iterations;
+        config.rngSeed = 4242;
+        config.enableProgressOutput = false;
+        config.enableUtilityTracking = false;
+        config.enableDataLogging = false;
+        config.outputPrefix = "test_prune_strategy";
+        return config;
+    };
+
+    // Baseline without pruning
+    mccfr::Trainer baseline(game);
+    baseline.train(makeConfig(4000));
+    double baselineExploit = baseline.computeExploitability(2000).exploitability;
+
+    // A restore interval of 1 makes every iteration a re-exploration, so
+    // enabling pruning must leave the run bit-for-bit unchanged
+    mccfr::Trainer restoreEvery(game);
+    {
+        auto config = makeConfig(4000);
+        config.enablePruning = true;
+        config.pruningRestoreInterval = 1;
+        restoreEvery.train(config);
+    }
+    {
+        auto expected = baseline.getAllStrategies();
+        auto actual = restoreEvery.getAllStrategies();
+        assert(actual.size() == expected.size());
+        for (const auto& [infoSet, strategy] : expected) {
+            auto it = actual.find(infoSet);
+            assert(it != actual.end());
+            assert(it->second == strategy);
+        }
+    }
+
+    // Active pruning: an aggressive threshold must actually change the
+    // traversal (same seed, different strategies) without hurting the
+    // learned strategy's quality
+    mccfr::Trainer pruned(game);
+    {
+        auto config = makeConfig(4000);
+        config.enablePruning = true;
+        config.pruningThreshold = -20.0;
+        config.pruningWarmupIterations = 500;
+        config.pruningRestoreInterval = 50;
+        pruned.train(config);
+    }
+    assert(pruned.getStats().informationSetsCount > 0);
+    {
+        auto expected = baseline.getAllStrategies();
+        auto actual = pruned.getAllStrategies();
+        bool anyDifferent = actual.size() != expected.size();
+        for (const auto& [infoSet, strategy] : expected) {
+            auto it = actual.find(infoSet);
+            if (it == actual.end() || it->second != strategy) {
+                anyDifferent = true;
+                break;
+            }
+        }
+        assert(anyDifferent);
+    }
+    double prunedExploit = pruned.computeExploitability(2000).exploitability;
+    assert(prunedExploit >= 0.0);
+    assert(prunedExploit < baselineExploit + 0.5);
+
+    // Pruning composes with the sharded parallel traversal
+    mccfr::Trainer parallel(game);
+    {
+        auto config = makeConfig(2000);
+        config.numThreads = 2;
+        config.enablePruning = true;
+        config.pruningThreshold = -20.0;
+        config.pruningWarmupIterations = 500;
+        config.pruningRestoreInterval = 50;
+        parallel.train(config);
+    }
+    assert(parallel.getStats().informationSetsCount > 0);
+
+    std::cout << "Pruning tests passed!" << std::endl;
+}
+
+void testBatchedTraining() {
+    std::cout << "Testing batched multi-deal iterations..." << std::endl;
+
+    aof::Game game(0.4, 1.0);
+
+    auto makeConfig = [](int iterations, int batchSize) {
+        mccfr::TrainingConfig config;
+        config.iterations = iterations;
+        config.batchSize = batchSize;
+        config.rngSeed = 1313;
+        config.enableProgressOutput = false;
+        config.enableUtilityTracking = false;
+        config.enableDataLogging = false;
+        config.outputPrefix = "test_batch_strategy";
+        return config;
+    };
+
+    // Two identical batched runs replay exactly
+    mccfr::Trainer first(game);
+    first.train(makeConfig(2000, 16));
+    assert(first.getStats().totalIterations == 2000);
+
+    mccfr::Trainer second(game);
+    second.train(makeConfig(2000, 16));
+    {
+        auto expected = first.getAllStrategies();
+        auto actual = second.getAllStrategies();
+        assert(actual.size() == expected.size());
+        for (const auto& [infoSet, strategy] : expected) {
+            auto it = actual.find(infoSet);
+            assert(it != actual.end());
+            assert(it->second == strategy);
+        }
+    }
+
+    // Batching regroups the work but trains on the same deal stream, so
+    // the learned strategy's quality must match the unbatched run's
+    mccfr::Trainer unbatched(game);
+    unbatched.train(makeConfig(2000, 1));
+    double batchedExploit = first.computeExploitability(2000).exploitability;
+    double unbatchedExploit = unbatched.computeExploitability(2000).exploitability;
+    assert(batchedExploit >= 0.0);
+    assert(batchedExploit < unbatchedExploit + 0.5);
+
+    // Checkpoints land on batch boundaries, so a resumed batched run
+    // reproduces an uninterrupted one bit for bit
+    mccfr::Trainer reference(game);
+    reference.train(makeConfig(600, 4));
+
+    mccfr::Trainer firstHalf(game);
+    firstHalf.train(makeConfig(300, 4));
+    assert(firstHalf.saveCheckpoint("test_batch.ckpt"));
+
+    mccfr::Trainer resumed(game);
+    assert(resumed.loadCheckpoint("test_batch.ckpt"));
+    resumed.train(makeConfig(600, 4));
+    assert(resumed.getStats().totalIterations == 600);
+    {
+        auto expected = reference.getAllStrategies();
+        auto actual = resumed.getAllStrategies();
+        assert(actual.size() == expected.size());
+        for (const auto& [infoSet, strategy] : expected) {
+            auto it = actual.find(infoSet);
+            assert(it != actual.end());
+            assert(it->second == strategy);
+        }
+    }
+
+    // Batching composes with the parallel trainer
+    mccfr::Trainer parallel(game);
+    {
+        auto config = makeConfig(2000, 8);
+        config.numThreads = 2;
+        parallel.train(config);
+    }
+    assert(parallel.getStats().totalIterations == 2000);
+    assert(parallel.getStats().informationSetsCount > 0);
+
+    std::remove("test_batch.ckpt");
+
+    std::cout << "Batched training tests passed!" << std::endl;
+}
+
+void testMemoryBudget() {
+    std::cout << "Testing node-map memory budget..." << std::endl;
+
+    aof::Game game(0.4, 1.0);
+
+    auto makeConfig = [](std::size_t budgetBytes) {
+        mccfr::TrainingConfig config;
+        config.iterations = 20000;
+        config.memoryBudgetBytes = budgetBytes;
+        config.rngSeed = 2121;
+        config.enableProgressOutput = false;
+        config.enableUtilityTracking = false;
+        config.enableDataLogging = false;
+        config.outputPrefix = "test_budget_strategy";
+        return config;
+    };
+
+    mccfr::Trainer unbudgeted(game);
+    unbudgeted.train(makeConfig(0));
+
+    // A budget the map never reaches must not perturb the run
+    mccfr::Trainer roomy(game);
+    roomy.train(makeConfig(64u << 20));
+    assert(roomy.getStats().spilledNodes == 0);
+    assert(roomy.getStats().peakNodeMapBytes > 0);
+    {
+        auto expected = unbudgeted.getAllStrategies();
+        auto actual = roomy.getAllStrategies();
+        assert(actual.size() == expected.size());
+        for (const auto& [infoSet, strategy] : expected) {
+            auto it = actual.find(infoSet);
+            assert(it != actual.end());
+            assert(it->second == strategy);
+        }
+    }
+
+    // A budget below the map's natural footprint forces spills; the
+    // spilled sums must be merged back before the run reports, and the
+    // learned strategy must stay playable (evicted nodes retrain after
+    // respawning, so the runs are not bit-identical)
+    mccfr::Trainer budgeted(game);
+    budgeted.train(makeConfig(128u * 1024));
+    assert(budgeted.getStats().spilledNodes > 0);
+    assert(budgeted.getStats().peakNodeMapBytes > 128u * 1024);
+    assert(budgeted.getStats().informationSetsCount ==
+           unbudgeted.getStats().informationSetsCount);
+    {
+        std::ifstream spill("test_budget_strategy_spill.bin");
+        assert(!spill.good());
+    }
+    double budgetedExploit = budgeted.computeExploitability(2000).exploitability;
+    double unbudgetedExploit = unbudgeted.computeExploitability(2000).exploitability;
+    assert(budgetedExploit >= 0.0);
+    assert(budgetedExploit < unbudgetedExploit + 0.5);
+
+    std::cout << "Memory budget tests passed!" << std::endl;
+}
+
+void testWarmStart() {
+    std::cout << "Testing warm start from a prior configuration..." << std::endl;
+
+    auto makeConfig = [](int iterations, const char* prefix) {
+        mccfr::TrainingConfig config;
+        config.iterations = iterations;
+        config.rngSeed = 4444;
+        config.enableProgressOutput = false;
+        config.enableUtilityTracking = false;
+        config.enableDataLogging = false;
+        config.outputPrefix = prefix;
+        return config;
+    };
+
+    // Train the prior configuration and save its strategies
+    aof::Game priorGame(0.4, 1.0);
+    mccfr::Trainer prior(priorGame);
+    prior.train(makeConfig(8000, "test_warm_prior"));
+    prior.saveStrategies("test_warm_prior.txt");
+
+    // Bad inputs are rejected without arming a prior
+    mccfr::Trainer rejects(priorGame);
+    assert(!rejects.warmStart("test_warm_missing.txt", 1000.0));
+    assert(!rejects.warmStart("test_warm_prior.txt", 0.0));
+
+    // Adjacent configuration: warm start must reach the cold run's
+    // exploitability in at most half the iterations
+    aof::Game nextGame(0.5, 1.0);
+
+    mccfr::Trainer cold(nextGame);
+    cold.train(makeConfig(4000, "test_warm_cold"));
+    double coldExploit = cold.computeExploitability(2000).exploitability;
+
+    mccfr::Trainer warm(nextGame);
+    assert(warm.warmStart("test_warm_prior.txt", 1000.0));
+    warm.train(makeConfig(2000, "test_warm_warm"));
+    double warmExploit = warm.computeExploitability(2000).exploitability;
+    assert(warmExploit <= coldExploit);
+
+    // The binary strategy format warm-starts the same way
+    {
+        mccfr::StrategyManager manager;
+        assert(manager.loadFromFile("test_warm_prior.txt"));
+        assert(manager.saveToBinary("test_warm_prior.bin"));
+
+        mccfr::Trainer binaryWarm(nextGame);
+        assert(binaryWarm.warmStart("test_warm_prior.bin", 1000.0));
+        binaryWarm.train(makeConfig(500, "test_warm_binary"));
+        assert(binaryWarm.getStats().informationSetsCount > 0);
+        std::remove("test_warm_prior.bin");
+    }
+
+    // Warm start composes with the parallel trainer
+    {
+        mccfr::Trainer parallel(nextGame);
+        assert(parallel.warmStart("test_warm_prior.txt", 1000.0));
+        auto config = makeConfig(2000, "test_warm_parallel");
+        config.numThreads = 2;
+        parallel.train(config);
+        assert(parallel.getStats().totalIterations == 2000);
+    }
+
+    std::remove("test_warm_prior.txt");
+
+    std::cout << "Warm start tests passed!" << std::endl;
+}
+
+void testProfiling() {
+    std::cout << "Testing hot-path instrumentation..." << std::endl;
+
+    aof::Game game(0.4, 1.0);
+    aof::profiling::resetAll();
+    mccfr::Trainer trainer(game);
+    mccfr::TrainingConfig config;
+    config.iterations = 200;
+    config.enableProgressOutput = false;
+    config.enableUtilityTracking = false;
+    config.outputPrefix = "test_profile_strategy";
+    trainer.train(config);
+
+#ifdef AOF_PROFILE
+    // Instrumented build: counters must have fired and the JSON dump exists
+    const auto& profile = trainer.getStats().profile;
+    assert(!profile.empty());
+    auto countOf = [&](const std::string& name) -> std::uint64_t {
+        for (const auto& entry : profile) {
+            if (entry.name == name) {
+                return entry.count;
+            }
+        }
+        return 0;
+    };
+    assert(countOf("rng_draws") > 0);
+    assert(countOf("node_map_probes") > 0);
+    assert(countOf("state_actions") > 0);
+    assert(countOf("infoset_encodes") > 0);
+    assert(countOf("traversal_ns") == 200);
+
+    std::ifstream json("test_profile_strategy_profile.json");
+    assert(json.good());
+    json.close();
+    std::remove("test_profile_strategy_profile.json");
+#else
+    // Default build compiles the instrumentation out entirely
+    assert(trainer.getStats().profile.empty());
+#endif
+
+    std::cout << "Profiling tests passed!" << std::endl;
+}
+
+void testExploitability() {
+    std::cout << "Testing best-response exploitability..." << std::endl;
+
+    aof::Game game(0.4, 1.0);
+
+    // An empty profile plays uniformly everywhere, which is clearly
+    // exploitable; the best response can never do worse than the profile
+    mccfr::BestResponseEvaluator uniform(game);
+    auto uniformResult = uniform.evaluate(2000, 1, 42);
+    assert(std::isfinite(uniformResult.exploitability));
+    assert(uniformResult.exploitability > 0.0);
+    for (int player = 0; player < 4; ++player) {
+        assert(uniformResult.bestResponseValues[player] >=
+               uniformResult.profileValues[player] - 1e-9);
+    }
+
+    // Profile values are a full profile expectation, so they stay
+    // zero-sum up to rake
+    double profileSum = 0.0;
+    for (double value : uniformResult.profileValues) {
+        profileSum += value;
+    }
+    assert(std::abs(profileSum) < 1e-6);
+    (void)profileSum;
+
+    // Per-deal seeds make the estimate independent of the thread count
+    // (up to summation order)
+    auto threadedResult = uniform.evaluate(2000, 4, 42);
+    assert(std::abs(threadedResult.exploitability -
+                    uniformResult.exploitability) < 1e-9);
+
+    // The same seed replays the same deals exactly
+    auto replayResult = uniform.evaluate(2000, 1, 42);
+    assert(replayResult.exploitability == uniformResult.exploitability);
+
+    // A trained profile must beat the uniform one
+    mccfr::Trainer trainer(game);
+    mccfr::TrainingConfig config;
+    config.iterations = 20000;
+    config.enableProgressOutput = false;
+    config.enableUtilityTracking = false;
+    config.outputPrefix = "test_exploit_strategy";
+    config.rngSeed = 99;
+    trainer.train(config);
+
+    auto trainedResult = trainer.computeExploitability(2000, 1, 42);
+    assert(trainedResult.exploitability < uniformResult.exploitability);
+
+    // The strategy-manager path loads the same profile the node map holds
+    trainer.saveStrategies("test_exploit_strategy.txt");
+    mccfr::StrategyManager manager;
+    assert(manager.loadFromFile("test_exploit_strategy.txt"));
+    mccfr::BestResponseEvaluator fromFile(game);
+    fromFile.loadFromStrategyManager(manager);
+    assert(fromFile.size() == manager.size());
+    auto fileResult = fromFile.evaluate(2000, 1, 42);
+    assert(std::abs(fileResult.exploitability -
+                    trainedResult.exploitability) < 1e-6);
+    std::remove("test_exploit_strategy.txt");
+
+    // A generous threshold stops training at the first evaluation
+    mccfr::Trainer earlyStop(game);
+    mccfr::TrainingConfig stopConfig;
+    stopConfig.iterations = 5000;
+    stopConfig.exploitabilityInterval = 500;
+    stopConfig.exploitabilityDeals = 500;
+    stopConfig.exploitabilityThreshold = 1000.0;
+    stopConfig.enableProgressOutput = false;
+    stopConfig.enableUtilityTracking = false;
+    stopConfig.outputPrefix = "test_exploit_strategy";
+    earlyStop.train(stopConfig);
+    assert(earlyStop.getStats().totalIterations == 500);
+
+    std::cout << "Exploitability tests passed!" << std::endl;
+}
+
+void testParallelTrainer() {
+    std::cout << "Testing parallel MCCFR Trainer..." << std::endl;
+
+    aof::Game game(0.4, 1.0);
+    mccfr::Trainer trainer(game);
+
+    mccfr::TrainingConfig config;
+    config.iterations = 1000;
+    config.numThreads = 4;
+    config.enableProgressOutput = false;
+    config.enableUtilityTracking = false;
+    config.outputPrefix = "test_parallel_strategy";
+
+    auto utilities = trainer.train(config);
+    assert(utilities.size() == 4);
+
+    auto stats = trainer.getStats();
+    assert(stats.totalIterations == 1000);
+    assert(stats.informationSetsCount > 0);
+
+    // Merged strategies must still be valid probability distributions
+    for (const auto& [infoSet, strategy] : trainer.getAllStrategies()) {
+        assert(strategy.size() == 2);
+        double sum = strategy[0] + strategy[1];
+        assert(std::abs(sum - 1.0) < 0.001);
+        (void)sum;
+    }
+
+    std::cout << "Parallel trainer tests passed!" << std::endl;
+}
+
 void testTrainer() {
     std::cout << "Testing MCCFR Trainer..." << std::endl;
     
@@ -129,7 +1691,21 @@ void testTrainer() {
         assert(strategy[1] >= 0 && strategy[1] <= 1);
         (void)sum; // Suppress unused variable warning
     }
-    
+
+    // An explicit seed makes single-threaded runs replay exactly
+    mccfr::TrainingConfig seededConfig;
+    seededConfig.iterations = 500;
+    seededConfig.enableProgressOutput = false;
+    seededConfig.enableUtilityTracking = false;
+    seededConfig.outputPrefix = "test_strategy";
+    seededConfig.rngSeed = 777;
+
+    mccfr::Trainer seededTrainerA(game);
+    mccfr::Trainer seededTrainerB(game);
+    seededTrainerA.train(seededConfig);
+    seededTrainerB.train(seededConfig);
+    assert(seededTrainerA.getAllStrategies() == seededTrainerB.getAllStrategies());
+
     std::cout << "Trainer tests passed!" << std::endl;
 }
 
@@ -193,8 +1769,31 @@ void testConvergence() {
 void runMCCFRTests() {
     try {
         testNode();
+        testUpdateRules();
+        testFlatNodeMap();
+        testInfoSetKey();
+        testShardedNodeMap();
+        testSpscRingBuffer();
         testUtils();
         testTrainer();
+        testOutcomeSampling();
+        testBinaryStrategyFile();
+        testStrategyAnalytics();
+        testStrategyQuery();
+        testStrategyKernels();
+        testDistributedSync();
+        testCheckpointing();
+        testResume();
+        testSweep();
+        testShmTelemetry();
+        testTelemetryLog();
+        testPruning();
+        testBatchedTraining();
+        testMemoryBudget();
+        testWarmStart();
+        testProfiling();
+        testExploitability();
+        testParallelTrainer();
         testInformationSetGeneration();
         testConvergence();
         
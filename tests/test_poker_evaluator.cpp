@@ -127,8 +127,9 @@ void testSevenCardEvaluation() {
     assert(!score.empty());
     
     // Should find the best 5-card hand from the 7 available
-    // In this case: A-A-A-K-Q (three of a kind, Aces)
-    assert(score[0] == static_cast<int>(aof::HandRank::THREE_OF_A_KIND));
+    // In this case: A-K-Q-J-10 (broadway straight), which beats the
+    // three aces also present in these 7 cards
+    assert(score[0] == static_cast<int>(aof::HandRank::STRAIGHT));
     
     // Test error cases
     try {
@@ -173,12 +174,86 @@ void testSpecialStraights() {
     std::cout << "Special straights tests passed!" << std::endl;
 }
 
+void testFastEvaluator() {
+    std::cout << "Testing fast 7-card evaluation..." << std::endl;
+
+    aof::PokerEvaluator evaluator;
+
+    // Known hands: straight flush beats quads beats full house
+    aof::Card board[5] = {
+        {"9", "s"}, {"10", "s"}, {"J", "s"}, {"A", "h"}, {"A", "d"}
+    };
+
+    auto straightFlush = evaluator.evaluateHandFast({"Q", "s"}, {"K", "s"}, board);
+    auto quads = evaluator.evaluateHandFast({"A", "s"}, {"A", "c"}, board);
+    auto fullHouse = evaluator.evaluateHandFast({"A", "s"}, {"9", "h"}, board);
+
+    assert(straightFlush > quads);
+    assert(quads > fullHouse);
+    assert((straightFlush >> 20) == static_cast<aof::HandValue>(aof::HandRank::STRAIGHT_FLUSH));
+    assert((quads >> 20) == static_cast<aof::HandValue>(aof::HandRank::FOUR_OF_A_KIND));
+    assert((fullHouse >> 20) == static_cast<aof::HandValue>(aof::HandRank::FULL_HOUSE));
+
+    // Fast path must order random matchups exactly like the combination-based path
+    aof::Deck deck(4242);
+    for (int trial = 0; trial < 500; ++trial) {
+        deck.reset();
+        auto cards = deck.dealCards(9);
+
+        std::vector<aof::Card> hole1 = {cards[0], cards[1]};
+        std::vector<aof::Card> hole2 = {cards[2], cards[3]};
+        std::vector<aof::Card> community(cards.begin() + 4, cards.end());
+
+        auto slow1 = evaluator.evaluateHand(hole1, community);
+        auto slow2 = evaluator.evaluateHand(hole2, community);
+        int slowCompare = aof::PokerEvaluator::compareHands(slow1, slow2);
+
+        auto fast1 = evaluator.evaluateHandFast(cards[0], cards[1], community.data());
+        auto fast2 = evaluator.evaluateHandFast(cards[2], cards[3], community.data());
+        int fastCompare = (fast1 > fast2) ? 1 : (fast1 < fast2) ? -1 : 0;
+
+        assert(slowCompare == fastCompare);
+        (void)slowCompare; (void)fastCompare;
+    }
+
+    // Batch entry point must match per-hand evaluation
+    deck.reset();
+    auto cards = deck.dealCards(13);
+    aof::HandValue batch[4];
+    evaluator.evaluateHandsFast(cards.data(), 4, cards.data() + 8, batch);
+
+    for (int player = 0; player < 4; ++player) {
+        auto single = evaluator.evaluateHandFast(cards[player * 2], cards[player * 2 + 1],
+                                                cards.data() + 8);
+        assert(batch[player] == single);
+        (void)single;
+    }
+
+    // Bulk board entry point must match per-board batch evaluation
+    deck.reset();
+    auto bulkCards = deck.dealCards(8 + 3 * 5);  // 4 players, 3 boards
+    aof::HandValue bulk[12];
+    evaluator.evaluateBoardsFast(bulkCards.data(), 4, bulkCards.data() + 8, 3, bulk);
+
+    for (int board = 0; board < 3; ++board) {
+        aof::HandValue perBoard[4];
+        evaluator.evaluateHandsFast(bulkCards.data(), 4,
+                                    bulkCards.data() + 8 + board * 5, perBoard);
+        for (int player = 0; player < 4; ++player) {
+            assert(bulk[board * 4 + player] == perBoard[player]);
+        }
+    }
+
+    std::cout << "Fast 7-card evaluation tests passed!" << std::endl;
+}
+
 void runPokerEvaluatorTests() {
     try {
         testHandEvaluation();
         testHandComparison();
         testSevenCardEvaluation();
         testSpecialStraights();
+        testFastEvaluator();
         
         std::cout << "\nAll poker evaluator tests passed successfully!" << std::endl;
         
@@ -2,7 +2,10 @@ import matplotlib.pyplot as plt
 import numpy as np
 import re
 import argparse
+import mmap
 import os
+import struct
+import time
 
 def parse_infosets(file_path):
     """Parse MCCFR strategy file and extract hand data"""
@@ -243,17 +246,165 @@ def plot_hand_range(hand_data, position_filter=None, output_file=None):
     else:
         plt.show()
 
+# --- Live telemetry (shared-memory ring written by the solver) ---------------
+#
+# The solver's --shm-ring <file> option maps a file containing a 64-byte
+# header followed by a power-of-two ring of 64-byte records, and publishes
+# each training data point with a single memcpy plus a release-store of the
+# sequence counter (see include/mccfr/shm_telemetry.hpp for the layout).
+# We mmap the same file and poll the counter; no pipe, socket or
+# serialization is involved on either side.
+
+RING_MAGIC = b'AOFSHMRG'
+RING_VERSION = 1
+# magic, version, record_size, capacity, sequence (header is padded to 64)
+RING_HEADER = struct.Struct('<8sIIQQ')
+RING_HEADER_SIZE = 64
+# iteration, num_players, mae, utility_sum, utilities[4], elapsed_ms
+RING_RECORD = struct.Struct('<iidd4dq')
+
+
+class TelemetryRing:
+    """Reader side of the solver's shared-memory telemetry ring"""
+
+    def __init__(self, path):
+        self.file = open(path, 'rb')
+        self.map = mmap.mmap(self.file.fileno(), 0, access=mmap.ACCESS_READ)
+        magic, version, record_size, self.capacity, _ = RING_HEADER.unpack_from(self.map, 0)
+        if magic != RING_MAGIC or version != RING_VERSION:
+            raise ValueError(f"{path} is not a version-{RING_VERSION} telemetry ring")
+        if record_size != RING_RECORD.size:
+            raise ValueError(f"Record size mismatch: file has {record_size}, "
+                             f"expected {RING_RECORD.size}")
+        self.next_sequence = 0
+        self.dropped = 0
+
+    def _sequence(self):
+        return RING_HEADER.unpack_from(self.map, 0)[4]
+
+    def poll(self):
+        """Return all records published since the last poll, oldest first"""
+        records = []
+        while True:
+            published = self._sequence()
+            if published == self.next_sequence:
+                return records
+
+            # Lapped: the slot exactly capacity behind may be mid-overwrite,
+            # so resume one slot inside the intact window
+            if published + 1 > self.next_sequence + self.capacity:
+                resume_at = published + 1 - self.capacity
+                self.dropped += resume_at - self.next_sequence
+                self.next_sequence = resume_at
+
+            slot = self.next_sequence % self.capacity
+            raw = bytes(self.map[RING_HEADER_SIZE + slot * RING_RECORD.size:
+                                 RING_HEADER_SIZE + (slot + 1) * RING_RECORD.size])
+
+            # The copy is only intact if the writer did not wrap onto this
+            # slot while we read it; otherwise resync and retry
+            if self._sequence() < self.next_sequence + self.capacity:
+                iteration, num_players, mae, utility_sum, u0, u1, u2, u3, elapsed_ms = \
+                    RING_RECORD.unpack(raw)
+                records.append({
+                    'iteration': iteration,
+                    'mae': mae,
+                    'utility_sum': utility_sum,
+                    'utilities': [u0, u1, u2, u3][:num_players],
+                    'elapsed_ms': elapsed_ms,
+                })
+                self.next_sequence += 1
+
+    def close(self):
+        self.map.close()
+        self.file.close()
+
+
+def live_dashboard(ring_path, poll_interval=0.2, max_points=2000):
+    """Poll the telemetry ring and plot training progress as it happens"""
+    ring = TelemetryRing(ring_path)
+    print(f"Following telemetry ring: {ring_path} "
+          f"({ring.capacity} slots, poll every {poll_interval}s)")
+
+    iterations, maes, utilities = [], [], []
+
+    plt.ion()
+    fig, (ax_mae, ax_util) = plt.subplots(2, 1, figsize=(10, 8), sharex=True)
+    fig.canvas.manager.set_window_title('MCCFR Training (live)')
+    mae_line, = ax_mae.plot([], [], color='#0066CC')
+    ax_mae.set_ylabel('Mean absolute error')
+    ax_mae.grid(True, alpha=0.3)
+    util_lines = []
+    ax_util.set_xlabel('Iteration')
+    ax_util.set_ylabel('Average utility (BB)')
+    ax_util.grid(True, alpha=0.3)
+
+    try:
+        while plt.fignum_exists(fig.number):
+            records = ring.poll()
+            for record in records:
+                iterations.append(record['iteration'])
+                maes.append(record['mae'])
+                utilities.append(record['utilities'])
+            if len(iterations) > max_points:
+                iterations = iterations[-max_points:]
+                maes = maes[-max_points:]
+                utilities = utilities[-max_points:]
+
+            if records:
+                mae_line.set_data(iterations, maes)
+                num_players = len(utilities[-1])
+                while len(util_lines) < num_players:
+                    player = len(util_lines)
+                    line, = ax_util.plot([], [], label=f'P{player}')
+                    util_lines.append(line)
+                    ax_util.legend(loc='upper right')
+                for player, line in enumerate(util_lines):
+                    line.set_data(iterations, [u[player] for u in utilities])
+                for ax in (ax_mae, ax_util):
+                    ax.relim()
+                    ax.autoscale_view()
+                latest = records[-1]
+                title = (f"Iteration {latest['iteration']:,} | "
+                         f"MAE {latest['mae']:.6f} | "
+                         f"{latest['elapsed_ms'] / 1000:.0f}s elapsed")
+                if ring.dropped:
+                    title += f" | {ring.dropped} points dropped"
+                fig.suptitle(title)
+
+            plt.pause(poll_interval)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        ring.close()
+
+
 def main():
     parser = argparse.ArgumentParser(description='Visualize MCCFR Strategy as GTO Wizard-style charts')
-    parser.add_argument('strategy_file', help='Path to the MCCFR strategy file')
+    parser.add_argument('strategy_file', nargs='?', help='Path to the MCCFR strategy file')
     parser.add_argument('--position', '-p', help='Player position to visualize (e.g., P0, P1, P2, P3)')
     parser.add_argument('--output', '-o', help='Output file path (PNG format)')
     parser.add_argument('--output-dir', '-d', help='Output directory for multiple charts')
-    parser.add_argument('--all-positions', '-a', action='store_true', 
+    parser.add_argument('--all-positions', '-a', action='store_true',
                        help='Generate charts for all positions')
-    
+    parser.add_argument('--live', metavar='RING_FILE',
+                       help='Follow a shared-memory telemetry ring written by '
+                            'the solver\'s --shm-ring option')
+
     args = parser.parse_args()
-    
+
+    if args.live:
+        if not os.path.exists(args.live):
+            print(f"Error: Telemetry ring '{args.live}' not found "
+                  f"(start the solver with --shm-ring {args.live})")
+            return
+        live_dashboard(args.live)
+        return
+
+    if not args.strategy_file:
+        print("Error: A strategy file (or --live <ring_file>) is required")
+        return
+
     if not os.path.exists(args.strategy_file):
         print(f"Error: Strategy file '{args.strategy_file}' not found")
         return